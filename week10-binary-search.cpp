@@ -15,12 +15,26 @@
  * - Compare iterative vs recursive implementations
  * - Analyze algorithm efficiency through iteration counting
  * - Practice with STL containers (set and vector)
+ * - See how memory layout (not just O(log n)) decides search speed
  */
 
 #include <iostream>
 #include <set>
 #include <vector>
 #include <iterator>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+#include <chrono>
+#include <random>
+#include <algorithm>
+
+// The AVX2 k-ary search is compiled with a per-function target attribute
+// and selected at run time, so no -mavx2 flag is needed
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define WEEK10_X86_SIMD 1
+#include <immintrin.h>
+#endif
 
 // ================================================
 // PART 1: Binary Search on std::set (iterators)
@@ -39,10 +53,215 @@ bool binarySearchRecursive(const std::vector<int>& v, int key,
                           int lhs, int rhs, int* iters);
 bool binarySearchRecursive(const std::vector<int>& v, int key, int* iters = nullptr);
 
+// ================================================
+// PART 4: Eytzinger (BFS-order) search index
+// ================================================
+// Static copy of a sorted vector stored in breadth-first (heap) order:
+// the root at [1], the children of node k at [2k] and [2k+1]. The first
+// levels of every search share the same few cache lines, and the 16
+// descendants four levels below node k are contiguous, so they can be
+// prefetched while the search is still walking down to them.
+class EytzingerIndex {
+public:
+    explicit EytzingerIndex(const std::vector<int>& sorted);
+
+    // Same contract as binarySearchVector(). iters counts levels visited;
+    // the descent never stops early, so it is always about log2(n) + 1.
+    bool search(int key, int* iters = nullptr) const;
+
+    std::size_t size() const { return n; }
+
+private:
+    std::vector<int> storage;  // Over-allocated so the array is 64-byte aligned
+    int* b;                    // b[1..n] in Eytzinger order, b[0] unused
+    std::size_t n;
+
+    std::size_t build(const std::vector<int>& sorted, std::size_t i, std::size_t k);
+};
+
+// ================================================
+// PART 5: Branchless and k-ary (SIMD) search on std::vector
+// ================================================
+// Same data and contract as binarySearchVector(), without the
+// hard-to-predict branches:
+//  - branchless: lower_bound where the only data-dependent step is
+//    base += (base[half] < key) * half, which compiles to a cmov/multiply
+//  - k-ary: each step compares the key against 16 evenly spaced pivots
+//    at once (two AVX2 gathers), narrowing the range 17-fold instead of
+//    2-fold, so a search needs about log17(n) dependent steps. Falls back
+//    to the branchless search on CPUs without AVX2, and for vectors of
+//    2^31 or more elements (gather indices are 32-bit lanes).
+// iters counts steps (halvings or 17-way splits) like the other searches.
+bool branchlessSearchVector(const std::vector<int>& v, int key, int* iters = nullptr);
+bool kArySearchVector(const std::vector<int>& v, int key, int* iters = nullptr);
+
+// ================================================
+// PART 6: Batched (interleaved) search on std::vector
+// ================================================
+// A single search is a chain of dependent loads: the next probe is not
+// known until the current one returns from memory. Searching BATCH_GROUP
+// keys together in lock step (every key takes one branchless step, then
+// the next step for all) puts one independent load per key in flight at
+// the same time.
+// found[i] is set to whether keys[i] is in v.
+void batchSearchVector(const std::vector<int>& v, const std::vector<int>& keys,
+                       std::vector<bool>& found);
+
+// ================================================
+// PART 7: Order-statistic set (dynamic, O(log n) rank/select)
+// ================================================
+// binarySearchSet() has to walk std::set iterators with std::distance()
+// and std::advance(), so each "halving" step is O(n). This set keeps the
+// size of every subtree in its nodes (a treap: a BST balanced by random
+// priorities), which gives:
+//   insert / erase / contains     O(log n) expected
+//   select(i)  - i-th smallest    O(log n)
+//   rank(key)  - # keys < key     O(log n)
+// Nodes live in one vector and link by index; erased slots are reused.
+class OrderStatisticSet {
+public:
+    OrderStatisticSet();
+
+    bool insert(int key);          // false if already present
+    bool erase(int key);           // false if not present
+    bool contains(int key) const;
+    int select(int i) const;       // 0 <= i < size()
+    int rank(int key) const;
+    int size() const { return nodes[root].size; }
+
+    // Binary search by descending the tree: each step discards one
+    // subtree, so it takes O(log n) steps (counted in iters)
+    bool search(int key, int* iters = nullptr) const;
+
+private:
+    struct Node {
+        int key;
+        unsigned priority;
+        int left, right;   // 0 = no child (slot 0 is an empty sentinel)
+        int size;
+    };
+
+    std::vector<Node> nodes;
+    std::vector<int> freeSlots;
+    int root;
+    unsigned seed;
+
+    int newNode(int key);
+    void update(int t);
+    void split(int t, int key, bool inclusive, int& l, int& r);
+    int merge(int a, int b);
+};
+
+// ================================================
+// PART 8: Learned index (radix spline) over a sorted vector
+// ================================================
+// Treats the sorted vector as a function key -> position and learns it:
+//  - a linear spline through some of the (key, position) points, built
+//    in one pass so that interpolating between spline points is never
+//    more than LEARNED_MAX_ERROR positions off for any stored key
+//  - a radix table on the top bits of the key that points straight at
+//    the few spline points that can hold it
+// A lookup is: radix table -> short search among spline points ->
+// interpolate -> branchless search in a window of 2 * error + 1 slots.
+// On smooth key sets the model is tiny compared with the data.
+// The index refers to the vector, which must outlive it and not change.
+class LearnedIndex {
+public:
+    explicit LearnedIndex(const std::vector<int>& sorted);
+
+    // Same contract as binarySearchVector(); iters counts search steps
+    // (spline point search + final window search)
+    bool search(int key, int* iters = nullptr) const;
+
+    std::size_t splinePoints() const { return spline.size(); }
+    std::size_t modelBytes() const;
+
+private:
+    struct SplinePoint {
+        long long key;
+        long long pos;
+    };
+
+    const std::vector<int>& data;
+    std::vector<SplinePoint> spline;
+    std::vector<std::uint32_t> radixTable;
+    long long minKey;
+    long long maxKey;
+    int shift;
+
+    void addSplinePoint(long long key, long long pos);
+    std::size_t lowerBound(int key, int& count) const;
+};
+
+// ================================================
+// PART 9: Interpolation, exponential and adaptive search
+// ================================================
+// - Interpolation: guesses the position from the key's value, like
+//   opening a phone book near "S". O(log log n) steps on uniformly
+//   spread keys; after any guess that fails to halve the range the next
+//   step bisects, so skewed keys still cost O(log n).
+// - Exponential (galloping): starts at hint and probes hint +- 1, 2, 4,
+//   ... before a binary search of the last gap. O(log d) steps for a key
+//   d positions from the hint: cheap near the front, the back or the
+//   previous answer.
+bool interpolationSearchVector(const std::vector<int>& v, int key, int* iters = nullptr);
+bool exponentialSearchVector(const std::vector<int>& v, int key, int* iters = nullptr,
+                             std::size_t hint = 0);
+
+// Picks the fastest of the searches above for one vector and one kind
+// of query stream: after one warm-up pass, each is timed
+// ADAPTIVE_ROUNDS times on a sample of queries (strategies interleaved)
+// and the best time counts.
+// Keeps the previous answer as the hint for the "finger" strategy.
+const int ADAPTIVE_ROUNDS = 5;
+
+class AdaptiveSearcher {
+public:
+    enum Strategy { BINARY, INTERPOLATION, GALLOP_FRONT, GALLOP_BACK, GALLOP_FINGER };
+
+    AdaptiveSearcher(const std::vector<int>& sorted, const std::vector<int>& sampleQueries);
+
+    bool search(int key, int* iters = nullptr);
+
+    Strategy strategy() const { return chosen; }
+    static const char* strategyName(Strategy s);
+
+private:
+    const std::vector<int>& data;
+    Strategy chosen;
+    std::size_t finger;  // Position of the previous answer
+
+    bool searchWith(Strategy s, int key, int* iters);
+};
+
+// Times every vector search above on n keys and 'queries' random lookups
+void benchmarkSearches(std::size_t n, std::size_t queries);
+
+// Times binarySearchSet() against OrderStatisticSet on n keys
+void benchmarkDynamicSets(int n, int queries);
+
+// Times the learned index against the other vector searches on n
+// random (uniformly distributed, not evenly spaced) keys
+void benchmarkLearnedIndex(std::size_t n, std::size_t queries);
+
+// Times each PART 9 strategy and the adaptive pick on three workloads
+void benchmarkAdaptiveSearch(std::size_t n, std::size_t queries);
+
 // ================================================
 // MAIN - Test all implementations
+// ./week10          interactive demo of every search
+// ./week10 --bench  large-scale benchmarks only (several seconds)
 // ================================================
-int main() {
+int main(int argc, char* argv[]) {
+    // Large-scale comparison: layout matters once the data outgrows cache
+    if (argc > 1 && std::strcmp(argv[1], "--bench") == 0) {
+        benchmarkSearches(std::size_t(1) << 22, 1000000);
+        benchmarkDynamicSets(1 << 16, 1000);
+        benchmarkLearnedIndex(std::size_t(1) << 22, 1000000);
+        benchmarkAdaptiveSearch(std::size_t(1) << 22, 1000000);
+        return 0;
+    }
+
     // Create and populate set
     std::set<int> numSet;
     int init[] = {2, 4, 6, 8, 10, 12, 14, 16, 18, 20};
@@ -113,7 +332,90 @@ int main() {
     std::cout << "Set iterations:       " << setIters << "\n";
     std::cout << "Vector iterations:    " << vecIters << "\n";
     std::cout << "Recursive iterations: " << recIters << "\n";
-    
+
+    // ================================================
+    // Test 4: Eytzinger layout
+    // ================================================
+    std::cout << "\n=== PART 4: Eytzinger search index ===\n";
+    EytzingerIndex index(numVec);
+    int eytIters = 0;
+    bool eytFound = index.search(key, &eytIters);
+    std::cout << key << (eytFound ? " found" : " not found") << " in the index"
+              << (eytFound == vecFound ? " (matches vector search)" : " (MISMATCH)") << "\n";
+    std::cout << "Levels visited: " << eytIters << "\n";
+
+    // ================================================
+    // Test 5: Branchless and k-ary search
+    // ================================================
+    std::cout << "\n=== PART 5: Branchless and k-ary search ===\n";
+    int brIters = 0;
+    int karyIters = 0;
+    bool brFound = branchlessSearchVector(numVec, key, &brIters);
+    bool karyFound = kArySearchVector(numVec, key, &karyIters);
+    std::cout << "Branchless: " << (brFound ? "found" : "not found")
+              << ", iterations: " << brIters << "\n";
+    std::cout << "k-ary:      " << (karyFound ? "found" : "not found")
+              << ", iterations: " << karyIters << "\n";
+
+    // ================================================
+    // Test 6: Batched search (every key 0..21 at once)
+    // ================================================
+    std::cout << "\n=== PART 6: Batched search ===\n";
+    std::vector<int> batchKeys;
+    for (int k = 0; k <= 21; ++k)
+        batchKeys.push_back(k);
+    std::vector<bool> batchFound;
+    batchSearchVector(numVec, batchKeys, batchFound);
+    std::cout << "Found in one batch:";
+    for (std::size_t i = 0; i < batchKeys.size(); ++i)
+        if (batchFound[i])
+            std::cout << " " << batchKeys[i];
+    std::cout << "\n";
+
+    // ================================================
+    // Test 7: Order-statistic set
+    // ================================================
+    std::cout << "\n=== PART 7: Order-statistic set ===\n";
+    OrderStatisticSet ostSet;
+    for (int x : init)
+        ostSet.insert(x);
+    int ostIters = 0;
+    bool ostFound = ostSet.search(key, &ostIters);
+    std::cout << key << (ostFound ? " found" : " not found")
+              << ", iterations: " << ostIters << "\n";
+    std::cout << "rank(" << key << ") = " << ostSet.rank(key)
+              << ", median = select(" << ostSet.size() / 2 << ") = "
+              << ostSet.select(ostSet.size() / 2) << "\n";
+    ostSet.insert(key);
+    ostSet.erase(init[0]);
+    std::cout << "After insert(" << key << "), erase(" << init[0] << "): size "
+              << ostSet.size() << ", smallest = select(0) = " << ostSet.select(0) << "\n";
+
+    // ================================================
+    // Test 8: Learned index
+    // ================================================
+    std::cout << "\n=== PART 8: Learned index ===\n";
+    LearnedIndex learned(numVec);
+    int learnedIters = 0;
+    bool learnedFound = learned.search(key, &learnedIters);
+    std::cout << key << (learnedFound ? " found" : " not found")
+              << ", iterations: " << learnedIters << "\n";
+    std::cout << "Model: " << learned.splinePoints() << " spline points, "
+              << learned.modelBytes() << " bytes\n";
+
+    // ================================================
+    // Test 9: Interpolation and exponential search
+    // ================================================
+    std::cout << "\n=== PART 9: Interpolation and exponential search ===\n";
+    int interpIters = 0;
+    int expIters = 0;
+    bool interpFound = interpolationSearchVector(numVec, key, &interpIters);
+    bool expFound = exponentialSearchVector(numVec, key, &expIters);
+    std::cout << "Interpolation: " << (interpFound ? "found" : "not found")
+              << ", iterations: " << interpIters << "\n";
+    std::cout << "Exponential:   " << (expFound ? "found" : "not found")
+              << ", iterations: " << expIters << "\n";
+
     return 0;
 }
 
@@ -227,6 +529,781 @@ bool binarySearchRecursive(const std::vector<int>& v, int key, int* iters) {
     return binarySearchRecursive(v, key, 0, v.size(), iters);
 }
 
+// ================================================
+// IMPLEMENTATION: Eytzinger Search Index
+// ================================================
+EytzingerIndex::EytzingerIndex(const std::vector<int>& sorted)
+    : storage(sorted.size() + 1 + 16), n(sorted.size()) {
+    // Align b (not b[1]) to 64 bytes so b[16k..16k+15] is one cache line
+    std::uintptr_t addr = reinterpret_cast<std::uintptr_t>(storage.data());
+    std::size_t skip = ((64 - addr % 64) % 64) / sizeof(int);
+    b = storage.data() + skip;
+    build(sorted, 0, 1);
+}
+
+// In-order walk of the implicit tree: the i-th smallest key goes to the
+// i-th node visited. Returns the next unused index into sorted.
+std::size_t EytzingerIndex::build(const std::vector<int>& sorted, std::size_t i, std::size_t k) {
+    if (k <= n) {
+        i = build(sorted, i, 2 * k);
+        b[k] = sorted[i++];
+        i = build(sorted, i, 2 * k + 1);
+    }
+    return i;
+}
+
+bool EytzingerIndex::search(int key, int* iters) const {
+    std::size_t k = 1;
+    int count = 0;
+
+    // Go right when b[k] < key, left otherwise - computed, not branched on
+    while (k <= n) {
+        __builtin_prefetch(b + 16 * k);  // Node 4 levels down
+        k = 2 * k + (b[k] < key);
+        ++count;
+    }
+
+    // The last left turn was at the lower bound: strip the trailing right
+    // turns (1 bits) and that left turn to get back to it
+    k >>= __builtin_ffsll(~k);
+
+    if (iters) *iters = count;
+    return k != 0 && b[k] == key;
+}
+
+// ================================================
+// IMPLEMENTATION: Branchless Binary Search
+// ================================================
+// Finishes a search on [base, base + len): returns the lower bound
+// (first position with *pos >= key, or base + len)
+static const int* branchlessLowerBound(const int* base, std::size_t len,
+                                       int key, int& count) {
+    if (len == 0) return base;
+
+    // Invariant: the lower bound is in [base, base + len]
+    while (len > 1) {
+        std::size_t half = len / 2;
+        // Without a branch the CPU no longer speculates ahead, so fetch
+        // both possible next midpoints ourselves
+        __builtin_prefetch(base + half / 2);
+        __builtin_prefetch(base + half + half / 2);
+        base += (base[half] < key) * half;  // No branch on the comparison
+        len -= half;
+        ++count;
+    }
+    return base + (*base < key);
+}
+
+bool branchlessSearchVector(const std::vector<int>& v, int key, int* iters) {
+    int count = 0;
+    const int* pos = branchlessLowerBound(v.data(), v.size(), key, count);
+    if (iters) *iters = count;
+    return pos != v.data() + v.size() && *pos == key;
+}
+
+// ================================================
+// IMPLEMENTATION: k-ary Search (AVX2)
+// ================================================
+#ifdef WEEK10_X86_SIMD
+const std::size_t KARY_PIVOTS = 16;
+const std::size_t KARY_MIN_RANGE = 64;  // Smaller ranges go branchless
+
+// Lower bound of key in v[0..n). Requires n <= INT32_MAX: gather indices
+// are 32-bit lanes (kArySearchVector() checks this)
+__attribute__((target("avx2")))
+static std::size_t kAryLowerBoundAvx2(const int* v, std::size_t n, int key, int& count) {
+    const __m256i keys = _mm256_set1_epi32(key);
+    const __m256i lowSteps = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 8);
+    const __m256i highSteps = _mm256_setr_epi32(9, 10, 11, 12, 13, 14, 15, 16);
+    std::size_t lo = 0;
+    std::size_t len = n;
+
+    // Invariant: the lower bound is in [lo, lo + len]
+    while (len >= KARY_MIN_RANGE) {
+        std::size_t step = len / (KARY_PIVOTS + 1);
+
+        // Pivots at lo + step, lo + 2*step, ..., lo + 16*step
+        __m256i base = _mm256_set1_epi32((int)lo);
+        __m256i stride = _mm256_set1_epi32((int)step);
+        __m256i idxLow = _mm256_add_epi32(base, _mm256_mullo_epi32(stride, lowSteps));
+        __m256i idxHigh = _mm256_add_epi32(base, _mm256_mullo_epi32(stride, highSteps));
+        __m256i pivLow = _mm256_i32gather_epi32(v, idxLow, 4);
+        __m256i pivHigh = _mm256_i32gather_epi32(v, idxHigh, 4);
+
+        // c = number of pivots < key (pivots are sorted)
+        int maskLow = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(keys, pivLow)));
+        int maskHigh = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(keys, pivHigh)));
+        std::size_t c = __builtin_popcount(maskLow) + __builtin_popcount(maskHigh);
+
+        // Keep the gap between pivot c and pivot c + 1
+        std::size_t end = c == KARY_PIVOTS ? lo + len : lo + (c + 1) * step;
+        lo = c == 0 ? lo : lo + c * step + 1;
+        len = end - lo;
+        ++count;
+    }
+
+    return branchlessLowerBound(v + lo, len, key, count) - v;
+}
+#endif
+
+bool kArySearchVector(const std::vector<int>& v, int key, int* iters) {
+    int count = 0;
+    std::size_t pos;
+#ifdef WEEK10_X86_SIMD
+    static const bool hasAvx2 = __builtin_cpu_supports("avx2");
+    if (hasAvx2 && v.size() <= (std::size_t)INT32_MAX)
+        pos = kAryLowerBoundAvx2(v.data(), v.size(), key, count);
+    else
+#endif
+        pos = branchlessLowerBound(v.data(), v.size(), key, count) - v.data();
+
+    if (iters) *iters = count;
+    return pos < v.size() && v[pos] == key;
+}
+
+// ================================================
+// IMPLEMENTATION: Learned Index (radix spline)
+// ================================================
+const long long LEARNED_MAX_ERROR = 32;   // Max |predicted - actual| position
+const int LEARNED_RADIX_BITS = 16;        // Radix table has 2^16 + 2 entries
+
+LearnedIndex::LearnedIndex(const std::vector<int>& sorted)
+    : data(sorted), minKey(0), maxKey(0), shift(0) {
+    std::size_t n = sorted.size();
+    if (n == 0) return;
+    minKey = sorted.front();
+    maxKey = sorted.back();
+
+    // Greedy spline corridor: from the last spline point, keep the range
+    // of slopes that stays within +-error of every point seen so far.
+    // When a point falls outside it, the previous point becomes a spline
+    // point and the corridor restarts from there.
+    addSplinePoint(sorted[0], 0);
+    long long baseKey = sorted[0];
+    long long basePos = 0;
+    long long prevKey = sorted[0];
+    long long prevPos = 0;
+    double upper = 1e300;
+    double lower = -1e300;
+    for (std::size_t i = 1; i < n; ++i) {
+        if (sorted[i] == sorted[i - 1]) continue;  // Model first occurrences
+        long long key = sorted[i];
+        long long pos = (long long)i;
+        double dx = (double)(key - baseKey);
+        double slope = (pos - basePos) / dx;
+
+        if (slope > upper || slope < lower) {
+            addSplinePoint(prevKey, prevPos);
+            baseKey = prevKey;
+            basePos = prevPos;
+            dx = (double)(key - baseKey);
+            upper = (pos + LEARNED_MAX_ERROR - basePos) / dx;
+            lower = (pos - LEARNED_MAX_ERROR - basePos) / dx;
+        } else {
+            upper = std::min(upper, (pos + LEARNED_MAX_ERROR - basePos) / dx);
+            lower = std::max(lower, (pos - LEARNED_MAX_ERROR - basePos) / dx);
+        }
+        prevKey = key;
+        prevPos = pos;
+    }
+    if (spline.back().key != prevKey)
+        addSplinePoint(prevKey, prevPos);
+
+    // Radix table: radixTable[p] = first spline point whose key has
+    // prefix >= p, so prefix p's points are in [table[p], table[p + 1]]
+    std::size_t range = (std::size_t)(maxKey - minKey);
+    while ((range >> shift) >= (std::size_t(1) << LEARNED_RADIX_BITS))
+        ++shift;
+    std::size_t prefixes = (range >> shift) + 1;
+    radixTable.assign(prefixes + 1, 0);
+    std::size_t p = 0;
+    for (std::size_t i = 0; i < spline.size(); ++i) {
+        std::size_t prefix = (std::size_t)(spline[i].key - minKey) >> shift;
+        while (p <= prefix)
+            radixTable[p++] = (std::uint32_t)i;
+    }
+    while (p <= prefixes)
+        radixTable[p++] = (std::uint32_t)spline.size() - 1;
+}
+
+void LearnedIndex::addSplinePoint(long long key, long long pos) {
+    SplinePoint point = { key, pos };
+    spline.push_back(point);
+}
+
+std::size_t LearnedIndex::modelBytes() const {
+    return spline.size() * sizeof(SplinePoint)
+         + radixTable.size() * sizeof(std::uint32_t);
+}
+
+// Position of the first element >= key
+std::size_t LearnedIndex::lowerBound(int key, int& count) const {
+    std::size_t n = data.size();
+    if (n == 0 || key <= minKey) return 0;
+    if (key > maxKey) return n;
+
+    // Spline segment (left, right] holding key: narrowed by the radix
+    // table, then a binary search over the few candidate points
+    std::size_t prefix = (std::size_t)(key - minKey) >> shift;
+    std::size_t first = radixTable[prefix];
+    std::size_t last = radixTable[prefix + 1];
+    while (first < last) {
+        ++count;
+        std::size_t mid = first + (last - first) / 2;
+        if (spline[mid].key < key)
+            first = mid + 1;
+        else
+            last = mid;
+    }
+    const SplinePoint& right = spline[first];
+    const SplinePoint& left = spline[first - 1];
+
+    // Interpolate, then search the error window around the prediction
+    long long predicted = left.pos + (long long)((double)(key - left.key)
+        * (right.pos - left.pos) / (double)(right.key - left.key));
+    std::size_t lo = (std::size_t)std::max(0LL, predicted - LEARNED_MAX_ERROR);
+    std::size_t hi = (std::size_t)std::min((long long)n, predicted + LEARNED_MAX_ERROR + 2);
+    std::size_t pos = branchlessLowerBound(data.data() + lo, hi - lo, key, count) - data.data();
+
+    // The bound holds for stored keys; a missing key next to a long run
+    // of duplicates can fall outside the window, so check and fall back
+    if ((lo > 0 && data[lo - 1] >= key) || (pos == hi && hi < n))
+        pos = branchlessLowerBound(data.data(), n, key, count) - data.data();
+    return pos;
+}
+
+bool LearnedIndex::search(int key, int* iters) const {
+    int count = 0;
+    std::size_t pos = lowerBound(key, count);
+    if (iters) *iters = count;
+    return pos < data.size() && data[pos] == key;
+}
+
+// ================================================
+// IMPLEMENTATION: Interpolation Search
+// ================================================
+bool interpolationSearchVector(const std::vector<int>& v, int key, int* iters) {
+    std::size_t lo = 0;
+    std::size_t hi = v.size();  // Invariant: lower bound in [lo, hi]
+    bool interpolate = true;
+    int count = 0;
+
+    while (lo < hi) {
+        if (key <= v[lo]) {
+            hi = lo;
+            break;
+        }
+        if (key > v[hi - 1]) {
+            lo = hi;
+            break;
+        }
+
+        // Here v[lo] < key <= v[hi - 1]: guess by value or bisect
+        std::size_t size = hi - lo;
+        std::size_t pos;
+        if (interpolate) {
+            double fraction = ((double)key - v[lo]) / ((double)v[hi - 1] - v[lo]);
+            pos = lo + (std::size_t)(fraction * (hi - 1 - lo));
+        } else {
+            pos = lo + size / 2;
+        }
+
+        ++count;
+        if (v[pos] < key)
+            lo = pos + 1;
+        else
+            hi = pos;
+
+        // Bisect next time if this step did not at least halve the range
+        interpolate = hi - lo <= size / 2;
+    }
+
+    if (iters) *iters = count;
+    return lo < v.size() && v[lo] == key;
+}
+
+// ================================================
+// IMPLEMENTATION: Exponential (galloping) Search
+// ================================================
+// Lower bound of key in v, galloping out from position hint
+static std::size_t gallopLowerBound(const std::vector<int>& v, int key,
+                                    std::size_t hint, int& count) {
+    std::size_t n = v.size();
+    if (n == 0) return 0;
+    hint = std::min(hint, n - 1);
+    const int* data = v.data();
+
+    std::size_t bound = 1;
+    std::size_t lo;
+    std::size_t hi;
+    ++count;
+    if (data[hint] < key) {
+        // Gallop right: the lower bound is in (hint + bound/2, hint + bound]
+        while (hint + bound < n && data[hint + bound] < key) {
+            bound *= 2;
+            ++count;
+        }
+        lo = hint + bound / 2 + 1;
+        hi = std::min(n, hint + bound);
+    } else {
+        // Gallop left: the lower bound is in (hint - bound, hint - bound/2]
+        while (bound <= hint && data[hint - bound] >= key) {
+            bound *= 2;
+            ++count;
+        }
+        lo = bound <= hint ? hint - bound + 1 : 0;
+        hi = hint - bound / 2;
+    }
+    return branchlessLowerBound(data + lo, hi - lo, key, count) - data;
+}
+
+bool exponentialSearchVector(const std::vector<int>& v, int key, int* iters,
+                             std::size_t hint) {
+    int count = 0;
+    std::size_t pos = gallopLowerBound(v, key, hint, count);
+    if (iters) *iters = count;
+    return pos < v.size() && v[pos] == key;
+}
+
+// ================================================
+// IMPLEMENTATION: Adaptive Searcher
+// ================================================
+AdaptiveSearcher::AdaptiveSearcher(const std::vector<int>& sorted,
+                                   const std::vector<int>& sampleQueries)
+    : data(sorted), chosen(BINARY), finger(0) {
+    const int numStrategies = GALLOP_FINGER + 1;
+    std::size_t found = 0;
+
+    // One untimed pass of every strategy first, so the first one timed
+    // does not pay for the cold cache and page faults
+    for (int s = BINARY; s <= GALLOP_FINGER; ++s) {
+        finger = 0;
+        for (int key : sampleQueries)
+            found += searchWith((Strategy)s, key, nullptr);
+    }
+
+    // Then ADAPTIVE_ROUNDS timed passes each, interleaved (round r starts
+    // with strategy r), keeping every strategy's best time. Each pass
+    // runs the sample in order, since the finger strategy depends on it.
+    double best[numStrategies];
+    for (int round = 0; round < ADAPTIVE_ROUNDS; ++round) {
+        for (int i = 0; i < numStrategies; ++i) {
+            int s = (round + i) % numStrategies;
+            finger = 0;
+            auto start = std::chrono::steady_clock::now();
+            for (int key : sampleQueries)
+                found += searchWith((Strategy)s, key, nullptr);
+            // Adding found (times zero) keeps the timed calls from being
+            // optimized away
+            double elapsed = std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - start).count() + found * 0.0;
+            if (round == 0 || elapsed < best[s])
+                best[s] = elapsed;
+        }
+    }
+
+    for (int s = BINARY; s <= GALLOP_FINGER; ++s)
+        if (best[s] < best[chosen])
+            chosen = (Strategy)s;
+    finger = 0;
+}
+
+bool AdaptiveSearcher::searchWith(Strategy s, int key, int* iters) {
+    switch (s) {
+        case INTERPOLATION:
+            return interpolationSearchVector(data, key, iters);
+        case GALLOP_FRONT:
+            return exponentialSearchVector(data, key, iters, 0);
+        case GALLOP_BACK:
+            return exponentialSearchVector(data, key, iters, data.size());
+        case GALLOP_FINGER: {
+            int count = 0;
+            finger = gallopLowerBound(data, key, finger, count);
+            if (iters) *iters = count;
+            return finger < data.size() && data[finger] == key;
+        }
+        default:
+            return branchlessSearchVector(data, key, iters);
+    }
+}
+
+bool AdaptiveSearcher::search(int key, int* iters) {
+    return searchWith(chosen, key, iters);
+}
+
+const char* AdaptiveSearcher::strategyName(Strategy s) {
+    switch (s) {
+        case INTERPOLATION: return "interpolation";
+        case GALLOP_FRONT:  return "gallop from front";
+        case GALLOP_BACK:   return "gallop from back";
+        case GALLOP_FINGER: return "gallop from last answer";
+        default:            return "binary (branchless)";
+    }
+}
+
+// ================================================
+// IMPLEMENTATION: Batched Search
+// ================================================
+const std::size_t BATCH_GROUP = 16;  // Keys searched in lock step
+
+void batchSearchVector(const std::vector<int>& v, const std::vector<int>& keys,
+                       std::vector<bool>& found) {
+    found.assign(keys.size(), false);
+    std::size_t n = v.size();
+    if (n == 0) return;
+
+    const int* data = v.data();
+    const int* base[BATCH_GROUP];
+
+    for (std::size_t first = 0; first < keys.size(); first += BATCH_GROUP) {
+        std::size_t group = std::min(BATCH_GROUP, keys.size() - first);
+        const int* key = keys.data() + first;
+        for (std::size_t j = 0; j < group; ++j)
+            base[j] = data;
+
+        // Every search has the same length sequence (it depends only on
+        // n), so one loop drives the whole group and the group's loads of
+        // one level overlap. No software prefetch: the group already keeps
+        // as many misses in flight as the core can track.
+        for (std::size_t len = n; len > 1; len -= len / 2) {
+            std::size_t half = len / 2;
+            for (std::size_t j = 0; j < group; ++j)
+                base[j] += (base[j][half] < key[j]) * half;
+        }
+
+        for (std::size_t j = 0; j < group; ++j) {
+            const int* pos = base[j] + (*base[j] < key[j]);
+            found[first + j] = pos != data + n && *pos == key[j];
+        }
+    }
+}
+
+// ================================================
+// IMPLEMENTATION: Order-Statistic Set (treap)
+// ================================================
+OrderStatisticSet::OrderStatisticSet() : nodes(1), root(0), seed(2463534242u) {
+    nodes[0].size = 0;  // Sentinel: size 0, so empty subtrees need no checks
+    nodes[0].left = nodes[0].right = 0;
+}
+
+int OrderStatisticSet::newNode(int key) {
+    // xorshift32 priorities: random enough to keep the treap balanced
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    Node node = { key, seed, 0, 0, 1 };
+
+    if (!freeSlots.empty()) {
+        int slot = freeSlots.back();
+        freeSlots.pop_back();
+        nodes[slot] = node;
+        return slot;
+    }
+    nodes.push_back(node);
+    return (int)nodes.size() - 1;
+}
+
+void OrderStatisticSet::update(int t) {
+    nodes[t].size = 1 + nodes[nodes[t].left].size + nodes[nodes[t].right].size;
+}
+
+// Splits tree t into l (keys < key, or <= key if inclusive) and r (rest)
+void OrderStatisticSet::split(int t, int key, bool inclusive, int& l, int& r) {
+    if (t == 0) {
+        l = r = 0;
+        return;
+    }
+    bool goesLeft = inclusive ? nodes[t].key <= key : nodes[t].key < key;
+    if (goesLeft) {
+        split(nodes[t].right, key, inclusive, nodes[t].right, r);
+        l = t;
+    } else {
+        split(nodes[t].left, key, inclusive, l, nodes[t].left);
+        r = t;
+    }
+    update(t);
+}
+
+// Joins trees a and b where every key in a is smaller than every key in b
+int OrderStatisticSet::merge(int a, int b) {
+    if (a == 0) return b;
+    if (b == 0) return a;
+    if (nodes[a].priority > nodes[b].priority) {
+        nodes[a].right = merge(nodes[a].right, b);
+        update(a);
+        return a;
+    }
+    nodes[b].left = merge(a, nodes[b].left);
+    update(b);
+    return b;
+}
+
+bool OrderStatisticSet::insert(int key) {
+    if (contains(key)) return false;
+    int l, r;
+    split(root, key, false, l, r);
+    root = merge(merge(l, newNode(key)), r);
+    return true;
+}
+
+bool OrderStatisticSet::erase(int key) {
+    int l, mid, r;
+    split(root, key, false, l, r);
+    split(r, key, true, mid, r);  // mid holds key alone, if present
+    if (mid != 0)
+        freeSlots.push_back(mid);
+    root = merge(l, r);
+    return mid != 0;
+}
+
+bool OrderStatisticSet::search(int key, int* iters) const {
+    int t = root;
+    int count = 0;
+
+    while (t != 0) {
+        ++count;
+        if (nodes[t].key == key) {
+            if (iters) *iters = count;
+            return true;
+        }
+        // Search right subtree if key is larger, left subtree otherwise
+        t = nodes[t].key < key ? nodes[t].right : nodes[t].left;
+    }
+
+    if (iters) *iters = count;
+    return false;
+}
+
+bool OrderStatisticSet::contains(int key) const {
+    return search(key);
+}
+
+int OrderStatisticSet::select(int i) const {
+    int t = root;
+    while (t != 0) {
+        int leftSize = nodes[nodes[t].left].size;
+        if (i == leftSize)
+            return nodes[t].key;
+        if (i < leftSize) {
+            t = nodes[t].left;
+        } else {
+            i -= leftSize + 1;
+            t = nodes[t].right;
+        }
+    }
+    return 0;  // i out of range
+}
+
+int OrderStatisticSet::rank(int key) const {
+    int t = root;
+    int smaller = 0;
+    while (t != 0) {
+        if (nodes[t].key < key) {
+            smaller += nodes[nodes[t].left].size + 1;
+            t = nodes[t].right;
+        } else {
+            t = nodes[t].left;
+        }
+    }
+    return smaller;
+}
+
+// ================================================
+// IMPLEMENTATION: Search Benchmark
+// ================================================
+void benchmarkSearches(std::size_t n, std::size_t queries) {
+    // Even keys 0, 2, 4, ...; queries hit and miss about equally often
+    std::vector<int> keys(n);
+    for (std::size_t i = 0; i < n; ++i)
+        keys[i] = (int)(2 * i);
+
+    std::mt19937 rng(10);
+    std::vector<int> lookups(queries);
+    for (std::size_t i = 0; i < queries; ++i)
+        lookups[i] = (int)(rng() % (2 * n));
+
+    EytzingerIndex index(keys);
+
+    std::cout << "\n=== BENCHMARK: " << n << " keys, " << queries << " lookups ===\n";
+
+    std::size_t baseFound = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int key : lookups)
+        baseFound += binarySearchVector(keys, key);
+    double baseNs = std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - start).count() / queries;
+    std::cout << "binarySearchVector:  " << baseNs << " ns/lookup\n";
+
+    // Times one search over all lookups and prints it next to the baseline
+    auto report = [&](const char* name, auto search) {
+        std::size_t found = 0;
+        auto t0 = std::chrono::steady_clock::now();
+        for (int key : lookups)
+            found += search(key);
+        double ns = std::chrono::duration<double, std::nano>(
+            std::chrono::steady_clock::now() - t0).count() / queries;
+        std::cout << name << ns << " ns/lookup  (" << baseNs / ns << "x)"
+                  << (found == baseFound ? "" : "  MISMATCH") << "\n";
+    };
+
+    report("EytzingerIndex:      ", [&](int key) { return index.search(key); });
+    report("Branchless:          ", [&](int key) { return branchlessSearchVector(keys, key); });
+    report("k-ary (AVX2):        ", [&](int key) { return kArySearchVector(keys, key); });
+
+    // Batched search answers all lookups in one call
+    std::vector<bool> batchFound;
+    auto t0 = std::chrono::steady_clock::now();
+    batchSearchVector(keys, lookups, batchFound);
+    double batchNs = std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - t0).count() / queries;
+    std::size_t found = std::count(batchFound.begin(), batchFound.end(), true);
+    std::cout << "Batched (" << BATCH_GROUP << " keys):   " << batchNs << " ns/lookup  ("
+              << baseNs / batchNs << "x)" << (found == baseFound ? "" : "  MISMATCH") << "\n";
+}
+
+void benchmarkDynamicSets(int n, int queries) {
+    std::set<int> stdSet;
+    OrderStatisticSet ostSet;
+    for (int i = 0; i < n; ++i) {
+        stdSet.insert(2 * i);
+        ostSet.insert(2 * i);
+    }
+
+    std::mt19937 rng(40);
+    std::vector<int> lookups(queries);
+    for (int& key : lookups)
+        key = (int)(rng() % (2 * n));
+
+    std::cout << "\n=== BENCHMARK: dynamic sets, " << n << " keys, " << queries << " lookups ===\n";
+
+    long long setIters = 0;
+    int setFound = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int key : lookups) {
+        int it = 0;
+        setFound += binarySearchSet(stdSet, key, &it);
+        setIters += it;
+    }
+    double setUs = std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - start).count() / queries;
+
+    long long ostIters = 0;
+    int ostFound = 0;
+    start = std::chrono::steady_clock::now();
+    for (int key : lookups) {
+        int it = 0;
+        ostFound += ostSet.search(key, &it);
+        ostIters += it;
+    }
+    double ostUs = std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - start).count() / queries;
+
+    std::cout << "binarySearchSet:      " << setUs << " us/lookup, "
+              << (double)setIters / queries << " iterations\n";
+    std::cout << "OrderStatisticSet:    " << ostUs << " us/lookup, "
+              << (double)ostIters / queries << " iterations  ("
+              << setUs / ostUs << "x)" << (ostFound == setFound ? "" : "  MISMATCH") << "\n";
+}
+
+void benchmarkLearnedIndex(std::size_t n, std::size_t queries) {
+    std::mt19937 rng(41);
+    std::vector<int> keys(n);
+    for (int& key : keys)
+        key = (int)(rng() & 0x7fffffff);
+    std::sort(keys.begin(), keys.end());
+
+    // Half the lookups are stored keys, half are random
+    std::vector<int> lookups(queries);
+    for (std::size_t i = 0; i < queries; ++i)
+        lookups[i] = i % 2 ? keys[rng() % n] : (int)(rng() & 0x7fffffff);
+
+    LearnedIndex learned(keys);
+    std::cout << "\n=== BENCHMARK: learned index, " << n << " random keys ===\n";
+    std::cout << "Model: " << learned.splinePoints() << " spline points, "
+              << learned.modelBytes() / 1024 << " KB (data: "
+              << n * sizeof(int) / 1024 << " KB)\n";
+
+    std::size_t baseFound = 0;
+    long long baseIters = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int key : lookups) {
+        int it = 0;
+        baseFound += binarySearchVector(keys, key, &it);
+        baseIters += it;
+    }
+    double baseNs = std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - start).count() / queries;
+    std::cout << "binarySearchVector:  " << baseNs << " ns/lookup, "
+              << (double)baseIters / queries << " iterations\n";
+
+    auto report = [&](const char* name, auto search) {
+        std::size_t found = 0;
+        long long iters = 0;
+        auto t0 = std::chrono::steady_clock::now();
+        for (int key : lookups) {
+            int it = 0;
+            found += search(key, &it);
+            iters += it;
+        }
+        double ns = std::chrono::duration<double, std::nano>(
+            std::chrono::steady_clock::now() - t0).count() / queries;
+        std::cout << name << ns << " ns/lookup, " << (double)iters / queries
+                  << " iterations  (" << baseNs / ns << "x)"
+                  << (found == baseFound ? "" : "  MISMATCH") << "\n";
+    };
+
+    report("Branchless:          ", [&](int key, int* it) { return branchlessSearchVector(keys, key, it); });
+    report("k-ary (AVX2):        ", [&](int key, int* it) { return kArySearchVector(keys, key, it); });
+    report("LearnedIndex:        ", [&](int key, int* it) { return learned.search(key, it); });
+}
+
+void benchmarkAdaptiveSearch(std::size_t n, std::size_t queries) {
+    std::mt19937 rng(42);
+    const char* workloads[] = {
+        "uniform keys, random queries",
+        "skewed keys, random queries",
+        "time series, recent queries"
+    };
+
+    std::cout << "\n=== BENCHMARK: adaptive search, " << n << " keys (ns/lookup) ===\n";
+    for (int w = 0; w < 3; ++w) {
+        // Keys: uniform random / squared (dense at the front) / timestamps
+        std::vector<int> keys(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            if (w == 0)
+                keys[i] = (int)(rng() & 0x7fffffff);
+            else if (w == 1)
+                keys[i] = (int)(((rng() & 0xffff) * (rng() & 0xffff)) >> 1);
+            else
+                keys[i] = (int)(i * 3 + rng() % 3);
+        }
+        std::sort(keys.begin(), keys.end());
+
+        // Queries: stored keys; for the time series, the newest 1000
+        std::vector<int> lookups(queries);
+        for (int& key : lookups)
+            key = w < 2 ? keys[rng() % n] : keys[n - 1 - rng() % 1000];
+
+        std::vector<int> sample(lookups.begin(), lookups.begin() + std::min<std::size_t>(queries, 2000));
+        AdaptiveSearcher adaptive(keys, sample);
+
+        std::cout << workloads[w] << " -> " << AdaptiveSearcher::strategyName(adaptive.strategy()) << "\n";
+        auto time = [&](const char* name, auto search) {
+            std::size_t found = 0;
+            auto t0 = std::chrono::steady_clock::now();
+            for (int key : lookups)
+                found += search(key);
+            double ns = std::chrono::duration<double, std::nano>(
+                std::chrono::steady_clock::now() - t0).count() / queries;
+            std::cout << "  " << name << ns << (found == queries ? "" : "  MISMATCH") << "\n";
+        };
+        time("binarySearchVector: ", [&](int key) { return binarySearchVector(keys, key); });
+        time("interpolation:      ", [&](int key) { return interpolationSearchVector(keys, key); });
+        time("gallop from back:   ", [&](int key) { return exponentialSearchVector(keys, key, nullptr, n); });
+        time("adaptive:           ", [&](int key) { return adaptive.search(key); });
+    }
+}
+
 /*
  * EXAMPLE OUTPUT:
  * 
@@ -250,6 +1327,67 @@ bool binarySearchRecursive(const std::vector<int>& v, int key, int* iters) {
  * Set iterations:       3
  * Vector iterations:    3
  * Recursive iterations: 3
+ * 
+ * === PART 4: Eytzinger search index ===
+ * 14 found in the index (matches vector search)
+ * Levels visited: 3
+ * 
+ * === PART 5: Branchless and k-ary search ===
+ * Branchless: found, iterations: 4
+ * k-ary:      found, iterations: 4
+ * 
+ * === PART 6: Batched search ===
+ * Found in one batch: 2 4 6 8 10 12 14 16 18 20
+ * 
+ * === PART 7: Order-statistic set ===
+ * 14 found, iterations: 3
+ * rank(14) = 6, median = select(5) = 12
+ * After insert(14), erase(2): size 9, smallest = select(0) = 4
+ * 
+ * === PART 8: Learned index ===
+ * 14 found, iterations: 4
+ * Model: 2 spline points, 112 bytes
+ * 
+ * === PART 9: Interpolation and exponential search ===
+ * Interpolation: found, iterations: 1
+ * Exponential:   found, iterations: 6
+ * 
+ * BENCHMARK OUTPUT (./week10 --bench):
+ * 
+ * === BENCHMARK: 4194304 keys, 1000000 lookups ===
+ * binarySearchVector:  421.159 ns/lookup
+ * EytzingerIndex:      114.669 ns/lookup  (3.67282x)
+ * Branchless:          216.578 ns/lookup  (1.94461x)
+ * k-ary (AVX2):        223.557 ns/lookup  (1.8839x)
+ * Batched (16 keys):   76.1476 ns/lookup  (5.53082x)
+ * 
+ * === BENCHMARK: dynamic sets, 65536 keys, 1000 lookups ===
+ * binarySearchSet:      1057.63 us/lookup, 15.551 iterations
+ * OrderStatisticSet:    0.738925 us/lookup, 20.726 iterations  (1431.31x)
+ * 
+ * === BENCHMARK: learned index, 4194304 random keys ===
+ * Model: 3521 spline points, 311 KB (data: 16384 KB)
+ * binarySearchVector:  399.256 ns/lookup, 21.4973 iterations
+ * Branchless:          190.243 ns/lookup, 22 iterations  (2.09867x)
+ * k-ary (AVX2):        229.754 ns/lookup, 9.99992 iterations  (1.73776x)
+ * LearnedIndex:        77.6511 ns/lookup, 7.05401 iterations  (5.14166x)
+ * 
+ * === BENCHMARK: adaptive search, 4194304 keys (ns/lookup) ===
+ * uniform keys, random queries -> interpolation
+ *   binarySearchVector: 397.666
+ *   interpolation:      201.345
+ *   gallop from back:   332.91
+ *   adaptive:           185.564
+ * skewed keys, random queries -> binary (branchless)
+ *   binarySearchVector: 377.844
+ *   interpolation:      493.744
+ *   gallop from back:   316.244
+ *   adaptive:           214.128
+ * time series, recent queries -> interpolation
+ *   binarySearchVector: 80.4896
+ *   interpolation:      13.4663
+ *   gallop from back:   33.6754
+ *   adaptive:           15.397
  */
 
 /*
@@ -273,6 +1411,11 @@ bool binarySearchRecursive(const std::vector<int>& v, int key, int* iters) {
  * - Slightly more overhead per iteration
  * - Already sorted by design
  * 
+ * Note: binarySearchSet() does O(log n) ITERATIONS, but std::distance()
+ * and std::advance() are O(n) on set iterators, so the whole search is
+ * O(n). OrderStatisticSet stores subtree sizes instead, so a search is
+ * O(log n) steps of O(1) each, and rank/select are O(log n) too.
+ * 
  * std::vector:
  * - Uses random access (indices)
  * - Direct array access: v[mid]
@@ -292,6 +1435,28 @@ bool binarySearchRecursive(const std::vector<int>& v, int key, int* iters) {
  * ✗ Function call overhead
  * ✗ Stack space usage
  * 
+ * COMPARISON: Sorted order vs Eytzinger order
+ * 
+ * Sorted order:
+ * - The probes of one search land far apart once the range is large,
+ *   so each level below the first few is a cache miss
+ * - Branching on v[mid] < key is mispredicted about half the time
+ * 
+ * Eytzinger (BFS) order:
+ * - Top levels of the tree sit together at the front of the array
+ * - Next index is 2k + (b[k] < key): no unpredictable branch
+ * - Prefetching b[16k] fetches the node 4 levels ahead, so several
+ *   misses overlap instead of happening one after another
+ * - Static: rebuilding is O(n), so it suits read-mostly lookup tables
+ * 
+ * Branchless and k-ary search (same sorted vector):
+ * - Branchless: always exactly ceil(log2(n)) steps, never mispredicts;
+ *   prefetching both possible next midpoints replaces the speculation
+ *   the branchy version got for free
+ * - k-ary: 16 pivots per step (two 8-wide gathers), so only about
+ *   log17(n) dependent steps; each step costs more, so it wins when the
+ *   loads, not the comparisons, are the bottleneck
+ * 
  * KEY INSIGHTS:
  * 
  * 1. Binary Search Requirements:
@@ -12,11 +12,35 @@
  * - Master recursive tree traversal algorithms
  * - Learn differences between traversal orders
  * - Practice queue usage for level-order processing
+ * - See how node layout in memory affects traversal speed
  */
 
 #include <vector>
 #include <queue>
 #include <iostream>
+#include <chrono>
+#include <algorithm>
+#include <unordered_map>
+#include <memory>
+#include <cstdint>
+#include <thread>
+#include <future>
+#include <set>
+#include <random>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <cstdio>
+#include <cstring>
+
+// Memory-mapped tree files (POSIX); other systems read the file instead
+#if defined(__unix__) || defined(__APPLE__)
+#define WEEK12_HAS_MMAP 1
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 using namespace std;
 
 // Binary Tree Node structure
@@ -204,6 +228,1198 @@ vector<int> postorderTraversal(BTNode* root) {
     return result;
 }
 
+// ============================================================================
+// PART 3: CACHE-OBLIVIOUS (VAN EMDE BOAS) TREE LAYOUT
+// ============================================================================
+
+/*
+ * BTNode trees are scattered across the heap: every step from a parent to
+ * a child is a pointer chase to wherever new put that child, so deep
+ * searches miss the cache at almost every level.
+ *
+ * BlockedTree copies a tree into ONE array in van Emde Boas order:
+ *   - cut the tree at half its height
+ *   - store the top half first, then every bottom subtree after it,
+ *     each laid out the same way, recursively
+ *
+ *              1                 vEB order for height 4:
+ *          /       \             [1 2 3] [4 8 9] [5 10 11] [6 12 13] [7 14 15]
+ *        2           3            top     bottom subtrees, one after another
+ *      /   \       /   \         (top = levels 1-2; bottom subtrees are
+ *     4     5     6     7          rooted at 4, 5, 6 and 7)
+ *    / \   / \   / \   / \       each bracket is one contiguous block,
+ *   8   9 10 11 12 13 14 15       laid out by the same rule inside
+ *
+ * At every scale, a subtree of about sqrt(size) nodes sits in contiguous
+ * memory, so a root-to-leaf path touches about log_B(n) cache lines for
+ * ANY cache line size B - without knowing B ("cache-oblivious").
+ *
+ * Children are 32-bit array indices (-1 = none), so a node is 12 bytes
+ * instead of 24, and five fit in a 64-byte cache line.
+ */
+class BlockedTree {
+public:
+    struct Node {
+        int val;
+        int left;   // Index of left child, -1 if none
+        int right;  // Index of right child, -1 if none
+    };
+
+    explicit BlockedTree(BTNode* root) {
+        if (root == nullptr) return;
+
+        // Pass 1: number the nodes in pre-order and record their values
+        // and children by number, without recursion so deep trees are fine.
+        // Everything below is indexed by pre-order number and freed when
+        // the constructor returns.
+        Shape shape;
+        vector<pair<BTNode*, int>> stack(1, { root, -1 });  // (node, parent slot)
+        while (!stack.empty()) {
+            BTNode* node = stack.back().first;
+            int parentSlot = stack.back().second;
+            stack.pop_back();
+
+            int id = (int)shape.val.size();
+            if (parentSlot >= 0) shape.child[parentSlot] = id;
+            shape.val.push_back(node->val);
+            shape.child.push_back(-1);  // Slot 2 * id: left
+            shape.child.push_back(-1);  // Slot 2 * id + 1: right
+            if (node->right) stack.push_back({ node->right, 2 * id + 1 });
+            if (node->left) stack.push_back({ node->left, 2 * id });
+        }
+        int n = (int)shape.val.size();
+
+        // Subtree heights: children come later in pre-order, so a reverse
+        // scan sees them first
+        shape.height.assign(n, 1);
+        for (int i = n - 1; i >= 0; --i) {
+            for (int c = 2 * i; c <= 2 * i + 1; ++c)
+                if (shape.child[c] != -1)
+                    shape.height[i] = max(shape.height[i], shape.height[shape.child[c]] + 1);
+        }
+
+        // Pass 2: lay out in vEB order, then link children by new index
+        vector<int> layout;
+        layout.reserve(n);
+        vector<int> frontier;
+        layoutVEB(shape, 0, shape.height[0], layout, frontier);
+
+        vector<int> position(n);
+        for (int i = 0; i < n; ++i)
+            position[layout[i]] = i;
+        nodes.resize(n);
+        for (int i = 0; i < n; ++i) {
+            int id = layout[i];
+            int left = shape.child[2 * id], right = shape.child[2 * id + 1];
+            nodes[i].val = shape.val[id];
+            nodes[i].left = left != -1 ? position[left] : -1;
+            nodes[i].right = right != -1 ? position[right] : -1;
+        }
+    }
+
+    int size() const { return (int)nodes.size(); }
+    const Node& node(int i) const { return nodes[i]; }
+
+    // BST search (only meaningful if the tree is ordered like a BST).
+    // Returns the number of nodes visited in *steps.
+    bool bstFind(int key, int* steps = nullptr) const {
+        int i = nodes.empty() ? -1 : 0;  // Root is always stored first
+        int count = 0;
+        while (i != -1) {
+            ++count;
+            if (nodes[i].val == key) break;
+            i = key < nodes[i].val ? nodes[i].left : nodes[i].right;
+        }
+        if (steps) *steps = count;
+        return i != -1;
+    }
+
+    // In-order traversal with an explicit stack; calls visit(val)
+    template<class Visit>
+    void inorder(Visit visit) const {
+        vector<int> stack;
+        int i = nodes.empty() ? -1 : 0;
+        while (i != -1 || !stack.empty()) {
+            while (i != -1) {
+                stack.push_back(i);
+                i = nodes[i].left;
+            }
+            i = stack.back();
+            stack.pop_back();
+            visit(nodes[i].val);
+            i = nodes[i].right;
+        }
+    }
+
+    // Whole-tree aggregate: order does not matter, so just scan the array
+    long long sum() const {
+        long long total = 0;
+        for (const Node& n : nodes)
+            total += n.val;
+        return total;
+    }
+
+private:
+    vector<Node> nodes;
+
+    // Build-time copy of the input tree, indexed by pre-order number
+    struct Shape {
+        vector<int> val;
+        vector<int> child;   // child[2i] = left, child[2i + 1] = right, -1 if none
+        vector<int> height;  // Height of the subtree rooted at i
+    };
+
+    // Appends the top 'levels' levels of the subtree at node to layout in
+    // vEB order; the nodes just below them are appended to frontier
+    static void layoutVEB(const Shape& shape, int node, int levels,
+                          vector<int>& layout, vector<int>& frontier) {
+        levels = min(levels, shape.height[node]);  // Skip empty levels
+        if (levels == 1) {
+            layout.push_back(node);
+            for (int c = 2 * node; c <= 2 * node + 1; ++c)
+                if (shape.child[c] != -1) frontier.push_back(shape.child[c]);
+            return;
+        }
+
+        int topLevels = levels / 2;
+        vector<int> middle;
+        layoutVEB(shape, node, topLevels, layout, middle);
+        for (int bottom : middle)
+            layoutVEB(shape, bottom, levels - topLevels, layout, frontier);
+    }
+};
+
+// ============================================================================
+// PART 4: ITERATIVE TRAVERSALS (NO RECURSION, NO TEMPORARY VECTORS)
+// ============================================================================
+
+/*
+ * The PART 2 traversals build a new vector at every node and copy each
+ * child's result into it: O(n * h) copying, and one stack frame per level,
+ * so a 10-million-deep (linked-list shaped) tree overflows the call stack.
+ *
+ * These versions hand each value to a visitor (any callable taking an
+ * int), so nothing is copied, and never recurse:
+ *   - in-order and pre-order use MORRIS THREADING: before descending
+ *     left, make the rightmost node of the left subtree point back to
+ *     the current node, so the walk can climb back up without a stack.
+ *     Every thread is removed again, so the tree ends up unchanged.
+ *     O(1) extra space (but the tree is briefly modified, so no other
+ *     thread may read it meanwhile).
+ *   - post-order uses an explicit stack on the heap: O(h) space, but
+ *     heap memory, not call-stack frames.
+ *
+ * The vector overloads append to a caller-provided buffer, which can be
+ * reused across calls without reallocating.
+ */
+
+// Rightmost node of node->left's subtree, stopping at a thread back to node
+BTNode* morrisPredecessor(BTNode* node) {
+    BTNode* pred = node->left;
+    while (pred->right != nullptr && pred->right != node)
+        pred = pred->right;
+    return pred;
+}
+
+template<class Visit>
+void inorderVisit(BTNode* root, Visit visit) {
+    BTNode* current = root;
+    while (current != nullptr) {
+        if (current->left == nullptr) {
+            visit(current->val);
+            current = current->right;  // Real child or thread upward
+            continue;
+        }
+
+        BTNode* pred = morrisPredecessor(current);
+        if (pred->right == nullptr) {
+            pred->right = current;      // First visit: thread, go left
+            current = current->left;
+        } else {
+            pred->right = nullptr;      // Back via the thread: left done
+            visit(current->val);
+            current = current->right;
+        }
+    }
+}
+
+template<class Visit>
+void preorderVisit(BTNode* root, Visit visit) {
+    BTNode* current = root;
+    while (current != nullptr) {
+        if (current->left == nullptr) {
+            visit(current->val);
+            current = current->right;
+            continue;
+        }
+
+        BTNode* pred = morrisPredecessor(current);
+        if (pred->right == nullptr) {
+            visit(current->val);        // Root before its left subtree
+            pred->right = current;
+            current = current->left;
+        } else {
+            pred->right = nullptr;
+            current = current->right;
+        }
+    }
+}
+
+template<class Visit>
+void postorderVisit(BTNode* root, Visit visit) {
+    vector<BTNode*> stack;
+    BTNode* current = root;
+    BTNode* lastVisited = nullptr;
+
+    while (current != nullptr || !stack.empty()) {
+        // Go as far left as possible
+        while (current != nullptr) {
+            stack.push_back(current);
+            current = current->left;
+        }
+
+        BTNode* top = stack.back();
+        if (top->right != nullptr && top->right != lastVisited) {
+            current = top->right;       // Right subtree not done yet
+        } else {
+            visit(top->val);            // Both subtrees done
+            lastVisited = top;
+            stack.pop_back();
+        }
+    }
+}
+
+// Buffer versions: append the traversal to out
+void inorderTraversal(BTNode* root, vector<int>& out) {
+    inorderVisit(root, [&out](int val) { out.push_back(val); });
+}
+
+void preorderTraversal(BTNode* root, vector<int>& out) {
+    preorderVisit(root, [&out](int val) { out.push_back(val); });
+}
+
+void postorderTraversal(BTNode* root, vector<int>& out) {
+    postorderVisit(root, [&out](int val) { out.push_back(val); });
+}
+
+// ============================================================================
+// PART 5: NODE ARENA (SLAB ALLOCATION, 32-BIT LINKS, O(1) BULK FREE)
+// ============================================================================
+
+/*
+ * createTree() calls new once per node, and freeing the tree means one
+ * delete per node. For trees that are built, queried and thrown away
+ * again, those allocator calls cost more than the tree work itself.
+ *
+ * NodeArena hands out nodes from big fixed-size slabs:
+ *   - allocating a node is a counter increment (a new slab every 64K nodes)
+ *   - links are 32-bit indices into the arena, so a node is 12 bytes
+ *     instead of BTNode's 24 (plus malloc's per-block overhead)
+ *   - reset() frees EVERY node at once in O(1) by rewinding the counter;
+ *     the slabs stay allocated and are reused by the next tree
+ *   - slabs never move, so a reference to a node stays valid while the
+ *     arena grows (unlike nodes kept in one growing vector)
+ */
+struct ArenaNode {
+    int val;
+    uint32_t left;   // Arena index of left child, NIL if none
+    uint32_t right;  // Arena index of right child, NIL if none
+};
+
+class NodeArena {
+public:
+    static constexpr uint32_t NIL = 0xffffffffu;
+
+    NodeArena() : used(0) {}
+
+    uint32_t allocate(int val) {
+        if ((used >> SLAB_BITS) == slabs.size())
+            slabs.emplace_back(new ArenaNode[SLAB_SIZE]);
+        uint32_t index = used++;
+        ArenaNode& node = (*this)[index];
+        node.val = val;
+        node.left = NIL;
+        node.right = NIL;
+        return index;
+    }
+
+    ArenaNode& operator[](uint32_t index) {
+        return slabs[index >> SLAB_BITS][index & (SLAB_SIZE - 1)];
+    }
+    const ArenaNode& operator[](uint32_t index) const {
+        return slabs[index >> SLAB_BITS][index & (SLAB_SIZE - 1)];
+    }
+
+    // Frees every node at once; the slabs are kept for reuse
+    void reset() { used = 0; }
+
+    // Also returns the slabs' memory to the system
+    void release() {
+        slabs.clear();
+        used = 0;
+    }
+
+    uint32_t size() const { return used; }
+
+private:
+    static constexpr uint32_t SLAB_BITS = 16;
+    static constexpr uint32_t SLAB_SIZE = 1u << SLAB_BITS;  // Nodes per slab
+
+    vector<unique_ptr<ArenaNode[]>> slabs;
+    uint32_t used;
+};
+
+/*
+ * Same level-order construction as createTree(), with nodes taken from
+ * the arena. Returns the root's index (NIL for an empty tree).
+ */
+uint32_t createTree(const vector<int>& levelOrder, NodeArena& arena) {
+    if (levelOrder.empty() || levelOrder[0] == -1)
+        return NodeArena::NIL;
+
+    uint32_t root = arena.allocate(levelOrder[0]);
+    queue<uint32_t> q;
+    q.push(root);
+
+    size_t i = 1;
+    while (!q.empty() && i < levelOrder.size()) {
+        uint32_t current = q.front();
+        q.pop();
+
+        // Process left child
+        if (i < levelOrder.size() && levelOrder[i] != -1) {
+            uint32_t child = arena.allocate(levelOrder[i]);
+            arena[current].left = child;
+            q.push(child);
+        }
+        i++;
+
+        // Process right child
+        if (i < levelOrder.size() && levelOrder[i] != -1) {
+            uint32_t child = arena.allocate(levelOrder[i]);
+            arena[current].right = child;
+            q.push(child);
+        }
+        i++;
+    }
+
+    return root;
+}
+
+// In-order traversal of an arena tree with an explicit stack
+template<class Visit>
+void inorderVisit(const NodeArena& arena, uint32_t root, Visit visit) {
+    vector<uint32_t> stack;
+    uint32_t current = root;
+    while (current != NodeArena::NIL || !stack.empty()) {
+        while (current != NodeArena::NIL) {
+            stack.push_back(current);
+            current = arena[current].left;
+        }
+        current = stack.back();
+        stack.pop_back();
+        visit(arena[current].val);
+        current = arena[current].right;
+    }
+}
+
+// ============================================================================
+// PART 6: PARALLEL CONSTRUCTION AND FORK-JOIN TRAVERSAL
+// ============================================================================
+
+/*
+ * createTree() needs its queue because a node's children are wherever
+ * the queue has got to. But the queue is predictable: the k-th non-null
+ * entry (counting from 0) always gets the entries at 2k+1 and 2k+2 as
+ * its children. So once every entry knows its rank k (a prefix count of
+ * non-null entries, computed in parallel chunks), every node - on every
+ * level at once - can be filled in independently:
+ *
+ *   levelOrder: [1, 2, 3, 4, 5, -1, -1, -1, -1, -1, 6]
+ *   rank:        0  1  2  3  4   .   .   .   .   .  5
+ *   node 1 (k=1) -> children at 3, 4 -> nodes 4 and 5
+ *
+ * The nodes go in a caller-owned vector<BTNode> (node k at storage[k]),
+ * so the whole tree is freed when that vector is destroyed.
+ */
+
+// Runs body(first, last, t) on slice t of numThreads slices of [0, n),
+// slice 0 on the calling thread, and waits for all of them
+template<class Body>
+void parallelFor(size_t n, int numThreads, Body body) {
+    vector<thread> workers;
+    for (int t = 1; t < numThreads; ++t)
+        workers.emplace_back(body, n * t / numThreads, n * (t + 1) / numThreads, t);
+    body(0, n / numThreads, 0);
+    for (thread& w : workers)
+        w.join();
+}
+
+int defaultThreads(int numThreads) {
+    return numThreads > 0 ? numThreads : max(1, (int)thread::hardware_concurrency());
+}
+
+BTNode* createTreeParallel(const vector<int>& levelOrder, vector<BTNode>& storage,
+                           int numThreads = 0) {
+    storage.clear();
+    if (levelOrder.empty() || levelOrder[0] == -1)
+        return nullptr;
+    numThreads = defaultThreads(numThreads);
+    size_t n = levelOrder.size();
+
+    // 1. Rank of every entry: count per chunk, then scan the chunk totals
+    vector<size_t> chunkCount(numThreads + 1, 0);
+    parallelFor(n, numThreads, [&](size_t first, size_t last, int t) {
+        size_t count = 0;
+        for (size_t i = first; i < last; ++i)
+            count += levelOrder[i] != -1;
+        chunkCount[t + 1] = count;
+    });
+    for (int t = 1; t <= numThreads; ++t)
+        chunkCount[t] += chunkCount[t - 1];
+
+    // createTree() stops once its queue runs dry: entry i (i >= 1) is
+    // only read if at least (i - 1) / 2 + 1 nodes come before it, so each
+    // slice also reports its first entry that would never be read
+    vector<uint32_t> rank(n);
+    vector<size_t> firstUnused(numThreads, n);
+    parallelFor(n, numThreads, [&](size_t first, size_t last, int t) {
+        size_t k = chunkCount[t];
+        for (size_t i = first; i < last; ++i) {
+            rank[i] = (uint32_t)k;
+            if (i > 0 && k <= (i - 1) / 2 && firstUnused[t] == n)
+                firstUnused[t] = i;
+            k += levelOrder[i] != -1;
+        }
+    });
+    size_t used = *min_element(firstUnused.begin(), firstUnused.end());
+    size_t nodeCount = used == n ? chunkCount[numThreads] : rank[used];
+
+    // 2. Fill every node independently
+    storage.assign(nodeCount, BTNode(0));
+    parallelFor(used, numThreads, [&](size_t first, size_t last, int) {
+        for (size_t i = first; i < last; ++i) {
+            if (levelOrder[i] == -1) continue;
+            BTNode& node = storage[rank[i]];
+            node.val = levelOrder[i];
+            size_t left = 2 * (size_t)rank[i] + 1;
+            size_t right = left + 1;
+            node.left = left < used && levelOrder[left] != -1 ? &storage[rank[left]] : nullptr;
+            node.right = right < used && levelOrder[right] != -1 ? &storage[rank[right]] : nullptr;
+        }
+    });
+
+    return &storage[0];
+}
+
+/*
+ * Fork-join reduction: where a node has two children, the left subtree
+ * becomes a new task while this thread takes the right one, until the
+ * task budget is used up; each task then finishes its subtree with an
+ * iterative pre-order walk (so deep subtrees are fine too).
+ *
+ *   map(val)        -> value for one node (val is an int&, so map may
+ *                      also modify it); it may have a different type
+ *                      from T if combine accepts (T, map result) too
+ *   combine(a, b)   -> must be associative; results are combined in
+ *                      pre-order (node, left subtree, right subtree).
+ *                      The accumulator a is passed as an rvalue, so a
+ *                      combine that takes it by value can append to it
+ *                      in place instead of copying it at every node.
+ */
+template<class T, class Map, class Combine>
+T reduceSequential(BTNode* root, T identity, Map& map, Combine& combine) {
+    T acc = identity;
+    vector<BTNode*> stack;
+    if (root) stack.push_back(root);
+    while (!stack.empty()) {
+        BTNode* node = stack.back();
+        stack.pop_back();
+        acc = combine(move(acc), map(node->val));
+        if (node->right) stack.push_back(node->right);
+        if (node->left) stack.push_back(node->left);
+    }
+    return acc;
+}
+
+template<class T, class Map, class Combine>
+T reduceTask(BTNode* node, T identity, Map& map, Combine& combine, int tasks) {
+    T acc = identity;
+
+    // Single-child chains give nothing to fork: walk them in a loop, so
+    // recursion depth stays O(log tasks) even on degenerate trees
+    while (node != nullptr && tasks > 1) {
+        acc = combine(move(acc), map(node->val));
+        if (node->left && node->right) {
+            int leftTasks = tasks / 2;
+            BTNode* leftChild = node->left;
+            future<T> left = async(launch::async, [&, leftChild, leftTasks]() {
+                return reduceTask(leftChild, identity, map, combine, leftTasks);
+            });
+            T right = reduceTask(node->right, identity, map, combine, tasks - leftTasks);
+            acc = combine(move(acc), left.get());
+            return combine(move(acc), move(right));
+        }
+        node = node->left ? node->left : node->right;
+    }
+    return combine(move(acc), reduceSequential(node, identity, map, combine));
+}
+
+// A few tasks per thread, so uneven subtrees still keep every core busy
+template<class T, class Map, class Combine>
+T parallelReduce(BTNode* root, T identity, Map map, Combine combine, int numThreads = 0) {
+    return reduceTask(root, identity, map, combine, 4 * defaultThreads(numThreads));
+}
+
+long long parallelSum(BTNode* root, int numThreads = 0) {
+    return parallelReduce(root, 0LL,
+                          [](int val) { return (long long)val; },
+                          [](long long a, long long b) { return a + b; },
+                          numThreads);
+}
+
+// Applies f(int& val) to every node
+template<class F>
+void parallelForEach(BTNode* root, F f, int numThreads = 0) {
+    parallelReduce(root, 0,
+                   [&f](int& val) { f(val); return 0; },
+                   [](int, int) { return 0; },
+                   numThreads);
+}
+
+// Values for which pred(val) is true, in pre-order. Each task appends
+// matches to its own accumulator vector; vectors are only concatenated
+// where two tasks join.
+struct FilterHit {
+    bool keep;
+    int val;
+};
+
+struct FilterCombine {
+    vector<int> operator()(vector<int> a, FilterHit hit) const {
+        if (hit.keep) a.push_back(hit.val);
+        return a;
+    }
+    vector<int> operator()(vector<int> a, vector<int> b) const {
+        if (a.empty()) return b;
+        a.insert(a.end(), b.begin(), b.end());
+        return a;
+    }
+};
+
+template<class Pred>
+vector<int> parallelFilter(BTNode* root, Pred pred, int numThreads = 0) {
+    return parallelReduce(root, vector<int>(),
+                          [&pred](int val) { return FilterHit{ pred(val), val }; },
+                          FilterCombine(),
+                          numThreads);
+}
+
+// ============================================================================
+// PART 7: SELF-BALANCING BINARY SEARCH TREE (AVL)
+// ============================================================================
+
+/*
+ * A plain BST built from sorted input is a linked list: height n, O(n)
+ * searches. An AVL tree keeps, at every node,
+ *
+ *     | height(left) - height(right) | <= 1
+ *
+ * which bounds the height by about 1.44 log2(n). After an insert or
+ * erase, heights are fixed on the way back up to the root, and any node
+ * that got out of balance is repaired with one or two rotations:
+ *
+ *        x                  y          (rotateLeft: right-heavy x)
+ *       / \                / \         x's right child y moves up,
+ *      a   y      ->      x   c        and y's left subtree b becomes
+ *         / \            / \           x's right subtree; in-order
+ *        b   c          a   b          (a x b y c) is unchanged
+ *
+ * The nodes are BTNode-style (value + left/right pointers) plus a parent
+ * pointer, which lets iterators walk to the in-order successor without a
+ * stack, and a height.
+ */
+struct AVLNode {
+    int val;
+    AVLNode* left;
+    AVLNode* right;
+    AVLNode* parent;
+    int height;  // Leaf = 1
+
+    AVLNode(int x, AVLNode* p) : val(x), left(nullptr), right(nullptr), parent(p), height(1) {}
+};
+
+class AVLTree {
+public:
+    // In-order (ascending) iterator. Erasing invalidates iterators.
+    class iterator {
+    public:
+        explicit iterator(AVLNode* n = nullptr) : node(n) {}
+
+        int operator*() const { return node->val; }
+        bool operator==(const iterator& other) const { return node == other.node; }
+        bool operator!=(const iterator& other) const { return node != other.node; }
+
+        iterator& operator++() {
+            if (node->right) {
+                // Successor is the leftmost node of the right subtree
+                node = node->right;
+                while (node->left)
+                    node = node->left;
+            } else {
+                // Otherwise the first ancestor we reach from its left side
+                AVLNode* child = node;
+                node = node->parent;
+                while (node && node->right == child) {
+                    child = node;
+                    node = node->parent;
+                }
+            }
+            return *this;
+        }
+
+    private:
+        AVLNode* node;
+    };
+
+    AVLTree() : root(nullptr), count(0) {}
+    ~AVLTree() { clear(); }
+
+    AVLTree(const AVLTree&) = delete;
+    AVLTree& operator=(const AVLTree&) = delete;
+
+    // Returns false if key was already present
+    bool insert(int key) {
+        AVLNode* parent = nullptr;
+        AVLNode* current = root;
+        while (current) {
+            if (key == current->val) return false;
+            parent = current;
+            current = key < current->val ? current->left : current->right;
+        }
+
+        AVLNode* node = new AVLNode(key, parent);
+        if (!parent)
+            root = node;
+        else if (key < parent->val)
+            parent->left = node;
+        else
+            parent->right = node;
+        ++count;
+        rebalanceFrom(parent);
+        return true;
+    }
+
+    // Returns false if key was not present
+    bool erase(int key) {
+        AVLNode* node = findNode(key);
+        if (!node) return false;
+
+        // Two children: take the successor's value, then remove the
+        // successor instead (it has no left child)
+        if (node->left && node->right) {
+            AVLNode* successor = node->right;
+            while (successor->left)
+                successor = successor->left;
+            node->val = successor->val;
+            node = successor;
+        }
+
+        // node now has at most one child: splice it out
+        AVLNode* child = node->left ? node->left : node->right;
+        AVLNode* parent = node->parent;
+        if (child) child->parent = parent;
+        replaceChild(parent, node, child);
+        delete node;
+        --count;
+        rebalanceFrom(parent);
+        return true;
+    }
+
+    iterator find(int key) const {
+        AVLNode* node = findNode(key);
+        return node ? iterator(node) : end();
+    }
+
+    // First element >= key
+    iterator lower_bound(int key) const {
+        AVLNode* current = root;
+        AVLNode* best = nullptr;
+        while (current) {
+            if (current->val < key) {
+                current = current->right;
+            } else {
+                best = current;
+                current = current->left;
+            }
+        }
+        return iterator(best);
+    }
+
+    iterator begin() const {
+        AVLNode* node = root;
+        while (node && node->left)
+            node = node->left;
+        return iterator(node);
+    }
+    iterator end() const { return iterator(nullptr); }
+
+    size_t size() const { return count; }
+    int height() const { return heightOf(root); }
+
+    // Frees every node (iteratively)
+    void clear() {
+        vector<AVLNode*> stack;
+        if (root) stack.push_back(root);
+        while (!stack.empty()) {
+            AVLNode* node = stack.back();
+            stack.pop_back();
+            if (node->left) stack.push_back(node->left);
+            if (node->right) stack.push_back(node->right);
+            delete node;
+        }
+        root = nullptr;
+        count = 0;
+    }
+
+private:
+    AVLNode* root;
+    size_t count;
+
+    static int heightOf(AVLNode* node) { return node ? node->height : 0; }
+
+    static void updateHeight(AVLNode* node) {
+        node->height = 1 + max(heightOf(node->left), heightOf(node->right));
+    }
+
+    AVLNode* findNode(int key) const {
+        AVLNode* current = root;
+        while (current && current->val != key)
+            current = key < current->val ? current->left : current->right;
+        return current;
+    }
+
+    // Makes newChild take oldChild's place under parent (or as the root)
+    void replaceChild(AVLNode* parent, AVLNode* oldChild, AVLNode* newChild) {
+        if (!parent)
+            root = newChild;
+        else if (parent->left == oldChild)
+            parent->left = newChild;
+        else
+            parent->right = newChild;
+    }
+
+    AVLNode* rotateLeft(AVLNode* x) {
+        AVLNode* y = x->right;
+        x->right = y->left;
+        if (y->left) y->left->parent = x;
+        y->parent = x->parent;
+        replaceChild(x->parent, x, y);
+        y->left = x;
+        x->parent = y;
+        updateHeight(x);
+        updateHeight(y);
+        return y;
+    }
+
+    AVLNode* rotateRight(AVLNode* x) {
+        AVLNode* y = x->left;
+        x->left = y->right;
+        if (y->right) y->right->parent = x;
+        y->parent = x->parent;
+        replaceChild(x->parent, x, y);
+        y->right = x;
+        x->parent = y;
+        updateHeight(x);
+        updateHeight(y);
+        return y;
+    }
+
+    // Fixes heights and balance from node up to the root
+    void rebalanceFrom(AVLNode* node) {
+        while (node) {
+            updateHeight(node);
+            int balance = heightOf(node->left) - heightOf(node->right);
+
+            if (balance > 1) {
+                // Left-heavy; left-right case needs a rotation first
+                if (heightOf(node->left->left) < heightOf(node->left->right))
+                    rotateLeft(node->left);
+                node = rotateRight(node);
+            } else if (balance < -1) {
+                // Right-heavy; right-left case needs a rotation first
+                if (heightOf(node->right->right) < heightOf(node->right->left))
+                    rotateRight(node->right);
+                node = rotateLeft(node);
+            }
+            node = node->parent;
+        }
+    }
+};
+
+// ============================================================================
+// PART 8: COMPACT TREE FILES (SUCCINCT SHAPE + VALUES, MEMORY-MAPPED)
+// ============================================================================
+
+/*
+ * A level-order vector<int> spends 4 bytes on every -1, and createTree()
+ * needs the whole vector in memory plus 24+ bytes per BTNode.
+ *
+ * The compact format stores the same tree as
+ *   - shape:  2 bits per node, in level order: "has left child",
+ *             "has right child" (exactly the -1 / not -1 pattern of the
+ *             level-order input after the root)
+ *   - values: the non-null values in level order (4 bytes each)
+ *   - rank directory: number of 1 bits before every 512-bit block
+ * so a node costs 4.25 bytes instead of 4 bytes + 4 per missing child.
+ *
+ * Navigation needs no pointers. Nodes are numbered 0, 1, 2, ... in level
+ * order, and the j-th 1 bit (counting from 1) stands for node j, so
+ *   left(k)  = number of 1 bits in shape[0 .. 2k]     if bit 2k is 1
+ *   right(k) = number of 1 bits in shape[0 .. 2k + 1] if bit 2k+1 is 1
+ * and the rank directory makes that count O(1).
+ *
+ * CompactTreeWriter takes level-order entries one at a time (no input
+ * vector needed), streams values straight to the file and keeps only the
+ * 2-bit shape in memory. CompactTreeView maps the file and navigates it
+ * in place: opening a 10 GB tree reads nothing until nodes are visited.
+ *
+ * File layout (little-endian):
+ *   header  { char magic[4] = "BTRC"; uint32 version; uint64 nodes; }
+ *   int32   values[nodes]
+ *   (padding to 8 bytes)
+ *   uint64  shape[ceil(2 * nodes / 64)]
+ *   uint64  rankDirectory[shape words / 8 + 1]
+ */
+struct CompactTreeHeader {
+    char magic[4];
+    uint32_t version;
+    uint64_t nodes;
+};
+
+const uint64_t COMPACT_WORDS_PER_BLOCK = 8;  // 512-bit rank blocks
+
+// Byte offsets of the sections for a tree with 'nodes' nodes
+uint64_t compactShapeOffset(uint64_t nodes) {
+    uint64_t end = sizeof(CompactTreeHeader) + nodes * sizeof(int32_t);
+    return (end + 7) / 8 * 8;
+}
+uint64_t compactShapeWords(uint64_t nodes) {
+    return (2 * nodes + 63) / 64;
+}
+
+class CompactTreeWriter {
+public:
+    explicit CompactTreeWriter(const string& path)
+        : out(path, ios::binary | ios::trunc), nodes(0), slots(0), done(false) {
+        CompactTreeHeader header = { { 'B', 'T', 'R', 'C' }, 1, 0 };
+        out.write((const char*)&header, sizeof(header));  // Patched in finish()
+    }
+
+    // Next level-order entry (-1 = no node). Entries createTree() would
+    // never read (after every node's two child slots are used) are ignored.
+    void add(int entry) {
+        if (done) return;
+        if (slots == 0) {
+            // Root: -1 means an empty tree
+            slots = 1;
+            if (entry == -1) {
+                done = true;
+                return;
+            }
+        } else {
+            if (slots > 2 * nodes) {
+                done = true;  // createTree() stops here
+                return;
+            }
+            setBit(slots - 1, entry != -1);
+            ++slots;
+            if (entry == -1) return;
+        }
+
+        int32_t value = entry;
+        out.write((const char*)&value, sizeof(value));
+        ++nodes;
+    }
+
+    // Writes shape, rank directory and header; returns false on I/O error
+    bool finish() {
+        // Missing trailing entries are null children (shape bits stay 0)
+        uint64_t words = compactShapeWords(nodes);
+        shape.resize(words, 0);
+
+        uint64_t padding = compactShapeOffset(nodes) - (sizeof(CompactTreeHeader) + nodes * sizeof(int32_t));
+        static const char zeros[8] = { 0 };
+        out.write(zeros, (streamsize)padding);
+        out.write((const char*)shape.data(), (streamsize)(words * sizeof(uint64_t)));
+
+        uint64_t ones = 0;
+        for (uint64_t w = 0; w <= words; ++w) {
+            if (w % COMPACT_WORDS_PER_BLOCK == 0)
+                out.write((const char*)&ones, sizeof(ones));
+            if (w < words)
+                ones += __builtin_popcountll(shape[w]);
+        }
+
+        CompactTreeHeader header = { { 'B', 'T', 'R', 'C' }, 1, nodes };
+        out.seekp(0);
+        out.write((const char*)&header, sizeof(header));
+        out.close();
+        return !out.fail();
+    }
+
+private:
+    ofstream out;
+    vector<uint64_t> shape;
+    uint64_t nodes;   // Non-null entries written so far
+    uint64_t slots;   // Entries consumed so far (root included)
+    bool done;
+
+    void setBit(uint64_t bit, bool value) {
+        if (bit / 64 >= shape.size())
+            shape.resize(bit / 64 + 1, 0);
+        if (value)
+            shape[bit / 64] |= 1ULL << (bit % 64);
+    }
+};
+
+// Writes a level-order list in the compact format
+bool writeCompactTree(const vector<int>& levelOrder, const string& path) {
+    CompactTreeWriter writer(path);
+    for (int entry : levelOrder)
+        writer.add(entry);
+    return writer.finish();
+}
+
+class CompactTreeView {
+public:
+    static const uint64_t NONE = ~0ULL;
+
+    explicit CompactTreeView(const string& path)
+        : base(nullptr), length(0), nodes(0), values(nullptr), shape(nullptr), rankDir(nullptr) {
+#ifdef WEEK12_HAS_MMAP
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return;
+        struct stat info;
+        if (fstat(fd, &info) == 0 && info.st_size > 0) {
+            void* mapped = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+            if (mapped != MAP_FAILED) {
+                base = (const char*)mapped;
+                length = (size_t)info.st_size;
+            }
+        }
+        ::close(fd);
+#else
+        ifstream in(path, ios::binary);
+        copyOfFile.assign(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+        base = copyOfFile.data();
+        length = copyOfFile.size();
+#endif
+        if (!base || length < sizeof(CompactTreeHeader)) return;
+
+        const CompactTreeHeader* header = (const CompactTreeHeader*)base;
+        uint64_t words = compactShapeWords(header->nodes);
+        uint64_t needed = compactShapeOffset(header->nodes)
+                        + (words + words / COMPACT_WORDS_PER_BLOCK + 1) * sizeof(uint64_t);
+        if (memcmp(header->magic, "BTRC", 4) != 0 || header->version != 1 || length < needed)
+            return;
+
+        nodes = header->nodes;
+        values = (const int32_t*)(base + sizeof(CompactTreeHeader));
+        shape = (const uint64_t*)(base + compactShapeOffset(nodes));
+        rankDir = shape + words;
+    }
+
+    ~CompactTreeView() {
+#ifdef WEEK12_HAS_MMAP
+        if (base) munmap((void*)base, length);
+#endif
+    }
+
+    CompactTreeView(const CompactTreeView&) = delete;
+    CompactTreeView& operator=(const CompactTreeView&) = delete;
+
+    bool valid() const { return values != nullptr; }
+    uint64_t size() const { return nodes; }
+    uint64_t root() const { return nodes > 0 ? 0 : NONE; }
+    int value(uint64_t k) const { return values[k]; }
+
+    uint64_t left(uint64_t k) const { return child(2 * k); }
+    uint64_t right(uint64_t k) const { return child(2 * k + 1); }
+
+private:
+    const char* base;
+    size_t length;
+    uint64_t nodes;
+    const int32_t* values;
+    const uint64_t* shape;
+    const uint64_t* rankDir;
+#ifndef WEEK12_HAS_MMAP
+    vector<char> copyOfFile;
+#endif
+
+    // Node for shape bit 'bit', i.e. the number of 1 bits in [0, bit]
+    uint64_t child(uint64_t bit) const {
+        uint64_t word = bit / 64;
+        uint64_t mask = 1ULL << (bit % 64);
+        if (!(shape[word] & mask)) return NONE;
+
+        uint64_t ones = rankDir[word / COMPACT_WORDS_PER_BLOCK];
+        for (uint64_t w = word / COMPACT_WORDS_PER_BLOCK * COMPACT_WORDS_PER_BLOCK; w < word; ++w)
+            ones += __builtin_popcountll(shape[w]);
+        ones += __builtin_popcountll(shape[word] & (mask | (mask - 1)));
+        return ones;
+    }
+};
+
+// In-order traversal straight from the mapped file (explicit stack)
+template<class Visit>
+void inorderVisit(const CompactTreeView& tree, Visit visit) {
+    vector<uint64_t> stack;
+    uint64_t current = tree.root();
+    while (current != CompactTreeView::NONE || !stack.empty()) {
+        while (current != CompactTreeView::NONE) {
+            stack.push_back(current);
+            current = tree.left(current);
+        }
+        current = stack.back();
+        stack.pop_back();
+        visit(tree.value(current));
+        current = tree.right(current);
+    }
+}
+
+// ============================================================================
+// PART 9: LCA AND SUBTREE QUERY INDEX (IN-ORDER NUMBERING + SPARSE TABLE)
+// ============================================================================
+
+/*
+ * Answering "lowest common ancestor of u and v" by walking BTNode
+ * pointers costs O(h) per query, and summing a subtree costs O(size).
+ * TreeIndex preprocesses a static tree once in O(n log n) and then
+ * answers both in O(1).
+ *
+ * Every node gets its in-order number as its id, so id i is the node
+ * at position i of inorderTraversal(root). Two facts about that
+ * numbering do all the work:
+ *
+ * 1. A subtree is a contiguous range of ids [first(v), last(v)], so
+ *    subtree sums are two prefix-sum lookups and "u is an ancestor of v"
+ *    is first(u) <= v <= last(u).
+ *
+ * 2. For u <= v, LCA(u, v) is the shallowest node among ids u .. v
+ *    (the in-order walk from u to v must pass through their LCA and
+ *    never leaves its subtree). That is a range-minimum query on depth,
+ *    answered in O(1) by a sparse table: level k stores the shallowest
+ *    id in every window of 2^k ids, and any range is covered by two
+ *    overlapping windows.
+ *
+ * Unlike an Euler tour (2n - 1 entries), the in-order array has only n
+ * entries, so the sparse table is half the size.
+ */
+class TreeIndex {
+public:
+    explicit TreeIndex(BTNode* root) {
+        // Iterative in-order walk. A frame is visited three times: on entry
+        // (descend left), after the left subtree (number the node, descend
+        // right) and after the right subtree (its last id is now known).
+        // 'first' is the next free id when the frame is pushed, which is
+        // the first id of its subtree.
+        struct Frame { BTNode* node; int depth; int first; int id; int stage; };
+        vector<Frame> stack;
+        if (root) stack.push_back({ root, 0, 0, -1, 0 });
+
+        while (!stack.empty()) {
+            Frame& frame = stack.back();
+            BTNode* next = nullptr;
+            if (frame.stage == 0) {
+                next = frame.node->left;
+            } else if (frame.stage == 1) {
+                frame.id = (int)nodes.size();
+                nodes.push_back(frame.node);
+                depths.push_back(frame.depth);
+                firsts.push_back(frame.first);
+                lasts.push_back(frame.id);
+                idOf[frame.node] = frame.id;
+                next = frame.node->right;
+            } else {
+                lasts[frame.id] = (int)nodes.size() - 1;
+                stack.pop_back();
+                continue;
+            }
+            ++frame.stage;
+            if (next) {
+                // 'frame' may dangle after push_back, so copy the depth first
+                int depth = frame.depth + 1;
+                stack.push_back({ next, depth, (int)nodes.size(), -1, 0 });
+            }
+        }
+
+        int n = (int)nodes.size();
+        prefix.assign(n + 1, 0);
+        for (int i = 0; i < n; ++i)
+            prefix[i + 1] = prefix[i] + nodes[i]->val;
+
+        sparse.push_back(vector<int>(n));
+        for (int i = 0; i < n; ++i)
+            sparse[0][i] = i;
+        for (int k = 1; (1 << k) <= n; ++k) {
+            const vector<int>& below = sparse[k - 1];
+            vector<int> level(n - (1 << k) + 1);
+            for (size_t i = 0; i < level.size(); ++i)
+                level[i] = shallower(below[i], below[i + (1 << (k - 1))]);
+            sparse.push_back(move(level));
+        }
+    }
+
+    int size() const { return (int)nodes.size(); }
+
+    // In-order id of a node (-1 if it is not in the tree)
+    int id(const BTNode* node) const {
+        auto it = idOf.find(node);
+        return it == idOf.end() ? -1 : it->second;
+    }
+    BTNode* node(int id) const { return nodes[id]; }
+    int depth(int id) const { return depths[id]; }
+
+    // O(1) lowest common ancestor of two valid ids (0 <= id < size())
+    int lca(int u, int v) const {
+        if (u > v) swap(u, v);
+        int k = 31 - __builtin_clz(v - u + 1);
+        return shallower(sparse[k][u], sparse[k][v - (1 << k) + 1]);
+    }
+    // nullptr if either node is not in the indexed tree
+    BTNode* lca(const BTNode* u, const BTNode* v) const {
+        int a = id(u), b = id(v);
+        if (a == -1 || b == -1) return nullptr;
+        return nodes[lca(a, b)];
+    }
+
+    bool isAncestor(int u, int v) const {
+        return firsts[u] <= v && v <= lasts[u];
+    }
+
+    // Subtree of 'id' is ids [subtreeFirst(id), subtreeLast(id)]; any
+    // aggregate over that slice of inorderTraversal() is a subtree query
+    int subtreeFirst(int id) const { return firsts[id]; }
+    int subtreeLast(int id) const { return lasts[id]; }
+    int subtreeSize(int id) const { return lasts[id] - firsts[id] + 1; }
+    long long subtreeSum(int id) const {
+        return prefix[lasts[id] + 1] - prefix[firsts[id]];
+    }
+
+private:
+    vector<BTNode*> nodes;          // By in-order id
+    vector<int> depths, firsts, lasts;
+    vector<long long> prefix;       // prefix[i] = sum of values of ids < i
+    vector<vector<int>> sparse;     // sparse[k][i] = shallowest id in [i, i + 2^k)
+    unordered_map<const BTNode*, int> idOf;
+
+    int shallower(int a, int b) const {
+        return depths[b] < depths[a] ? b : a;
+    }
+};
+
 // ============================================================================
 // UTILITY FUNCTIONS
 // ============================================================================
@@ -216,11 +1432,353 @@ void printTraversal(const vector<int>& traversal) {
     cout << endl;
 }
 
+// Frees every node of a tree (iterative, so deep trees are fine)
+void deleteTree(BTNode* root) {
+    vector<BTNode*> stack;
+    if (root) stack.push_back(root);
+    while (!stack.empty()) {
+        BTNode* node = stack.back();
+        stack.pop_back();
+        if (node->left) stack.push_back(node->left);
+        if (node->right) stack.push_back(node->right);
+        delete node;
+    }
+}
+
+// Level-order input for a complete BST holding 0, 2, 4, ..., 2(n-1):
+// slot k of a heap-ordered array gets the next key of an in-order walk
+vector<int> balancedBSTLevelOrder(int n) {
+    vector<int> levelOrder(n);
+    int next = 0;
+    vector<int> stack;
+    int k = 1;  // 1-based heap index
+    while (k <= n || !stack.empty()) {
+        while (k <= n) {
+            stack.push_back(k);
+            k = 2 * k;
+        }
+        k = stack.back();
+        stack.pop_back();
+        levelOrder[k - 1] = 2 * next++;
+        k = 2 * k + 1;
+    }
+    return levelOrder;
+}
+
+// Builds a 'depth'-deep tree (every node only has a right child) and
+// checks that all three iterative traversals get through it
+void checkDeepTree(int depth) {
+    vector<int> chain(2 * (size_t)depth - 1, -1);
+    for (int i = 0; i < depth; ++i)
+        chain[2 * i] = i % 1000;
+    BTNode* deep = createTree(chain);
+    vector<int>().swap(chain);
+
+    long long inSum = 0, preSum = 0, postSum = 0;
+    inorderVisit(deep, [&](int val) { inSum += val; });
+    preorderVisit(deep, [&](int val) { preSum += val; });
+    postorderVisit(deep, [&](int val) { postSum += val; });
+    cout << "\n" << depth << "-deep tree traversed iteratively: sums "
+         << inSum << " / " << preSum << " / " << postSum << endl;
+    deleteTree(deep);
+}
+
+// Times BST searches and an in-order traversal on BTNodes vs BlockedTree
+void benchmarkTreeLayouts(int n, int queries) {
+    BTNode* root = createTree(balancedBSTLevelOrder(n));
+    BlockedTree blocked(root);
+
+    vector<int> keys(queries);
+    unsigned seed = 12345;
+    for (int& key : keys) {
+        seed = seed * 1103515245u + 12345u;
+        key = (int)((seed >> 1) % (2u * n));
+    }
+
+    cout << "\n=== BENCHMARK: " << n << "-node BST, " << queries << " searches ===" << endl;
+
+    // Pointer-based BST search
+    int found = 0;
+    auto start = chrono::steady_clock::now();
+    for (int key : keys) {
+        BTNode* node = root;
+        while (node && node->val != key)
+            node = key < node->val ? node->left : node->right;
+        found += node != nullptr;
+    }
+    double pointerNs = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / queries;
+
+    int blockedFound = 0;
+    start = chrono::steady_clock::now();
+    for (int key : keys)
+        blockedFound += blocked.bstFind(key);
+    double blockedNs = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / queries;
+
+    cout << "BTNode search:      " << pointerNs << " ns" << endl;
+    cout << "BlockedTree search: " << blockedNs << " ns  (" << pointerNs / blockedNs << "x)"
+         << (found == blockedFound ? "" : "  MISMATCH") << endl;
+
+    // In-order traversal: the PART 2 version vs the blocked layout
+    start = chrono::steady_clock::now();
+    long long pointerSum = 0;
+    for (int val : inorderTraversal(root))
+        pointerSum += val;
+    double pointerMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    start = chrono::steady_clock::now();
+    long long blockedSum = 0;
+    blocked.inorder([&](int val) { blockedSum += val; });
+    double blockedMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    cout << "inorderTraversal():   " << pointerMs << " ms" << endl;
+    cout << "BlockedTree in-order: " << blockedMs << " ms  (" << pointerMs / blockedMs << "x)"
+         << (pointerSum == blockedSum ? "" : "  MISMATCH") << endl;
+
+    deleteTree(root);
+}
+
+// Times build + traverse + free of 'rounds' trees: new/delete vs arena
+void benchmarkArena(int n, int rounds) {
+    vector<int> levelOrder(n);
+    for (int i = 0; i < n; ++i)
+        levelOrder[i] = i % 1000;
+
+    cout << "\n=== BENCHMARK: build + traverse + free, " << rounds
+         << " trees of " << n << " nodes ===" << endl;
+
+    long long pointerSum = 0;
+    auto start = chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        BTNode* root = createTree(levelOrder);
+        inorderVisit(root, [&](int val) { pointerSum += val; });
+        deleteTree(root);
+    }
+    double pointerMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count() / rounds;
+
+    NodeArena arena;
+    long long arenaSum = 0;
+    start = chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        uint32_t root = createTree(levelOrder, arena);
+        inorderVisit(arena, root, [&](int val) { arenaSum += val; });
+        arena.reset();
+    }
+    double arenaMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count() / rounds;
+
+    cout << "new/delete BTNode (24 bytes): " << pointerMs << " ms per tree" << endl;
+    cout << "NodeArena (" << sizeof(ArenaNode) << " bytes):        " << arenaMs << " ms per tree  ("
+         << pointerMs / arenaMs << "x)" << (pointerSum == arenaSum ? "" : "  MISMATCH") << endl;
+}
+
+// Times serial vs parallel construction and reduction on an n-node tree
+void benchmarkParallelTrees(int n) {
+    vector<int> levelOrder(n);
+    for (int i = 0; i < n; ++i)
+        levelOrder[i] = i % 1000;
+
+    cout << "\n=== BENCHMARK: parallel trees, " << n << " nodes, "
+         << defaultThreads(0) << " hardware threads ===" << endl;
+
+    // Both sides use the same code, storage layout and tree; only the
+    // thread count differs, so the ratios measure parallel scaling
+    int threads = defaultThreads(0);
+
+    // Best of three runs, so neither side pays for first-touch page faults
+    auto bestMs = [](auto run) {
+        double best = 1e300;
+        for (int r = 0; r < 3; ++r) {
+            auto start = chrono::steady_clock::now();
+            run();
+            best = min(best, chrono::duration<double, milli>(chrono::steady_clock::now() - start).count());
+        }
+        return best;
+    };
+
+    vector<BTNode> storage;
+    BTNode* root = nullptr;
+    double serialBuildMs = bestMs([&]() { root = createTreeParallel(levelOrder, storage, 1); });
+    double parallelBuildMs = bestMs([&]() { root = createTreeParallel(levelOrder, storage, threads); });
+
+    long long serialSum = 0, sum = 0;
+    double serialSumMs = bestMs([&]() { serialSum = parallelSum(root, 1); });
+    double parallelSumMs = bestMs([&]() { sum = parallelSum(root, threads); });
+
+    string all = to_string(threads) + " thread(s):";
+    cout << left;
+    cout << "createTreeParallel, " << setw(14) << "1 thread:" << serialBuildMs << " ms" << endl;
+    cout << "createTreeParallel, " << setw(14) << all << parallelBuildMs << " ms  ("
+         << serialBuildMs / parallelBuildMs << "x)" << endl;
+    cout << "parallelSum,        " << setw(14) << "1 thread:" << serialSumMs << " ms" << endl;
+    cout << "parallelSum,        " << setw(14) << all << parallelSumMs << " ms  ("
+         << serialSumMs / parallelSumMs << "x)"
+         << (sum == serialSum ? "" : "  MISMATCH") << endl;
+    cout << right;
+}
+
+// Builds and searches AVLTree, std::set and a sorted vector (the week 10
+// binary search setup) at 10^3, 10^4, ... maxKeys keys
+void benchmarkBalancedTrees(int maxKeys, int queries) {
+    cout << "\n=== BENCHMARK: AVL tree vs std::set vs sorted vector ===" << endl;
+    cout << left << setw(10) << "keys" << setw(12) << "AVL build" << setw(12) << "set build"
+         << setw(12) << "AVL find" << setw(12) << "set find" << setw(12) << "vector find"
+         << "AVL height" << endl;
+    cout << setw(10) << "" << setw(12) << "(ns/key)" << setw(12) << "(ns/key)"
+         << setw(12) << "(ns)" << setw(12) << "(ns)" << setw(12) << "(ns)" << endl;
+
+    mt19937 rng(47);
+    for (int n = 1000; n <= maxKeys; n *= 10) {
+        vector<int> keys(n);
+        for (int& key : keys)
+            key = (int)(rng() & 0x7fffffff);
+        vector<int> lookups(queries);
+        for (int i = 0; i < queries; ++i)
+            lookups[i] = i % 2 ? keys[rng() % n] : (int)(rng() & 0x7fffffff);
+
+        auto start = chrono::steady_clock::now();
+        AVLTree avl;
+        for (int key : keys)
+            avl.insert(key);
+        double avlBuild = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / n;
+
+        start = chrono::steady_clock::now();
+        set<int> stdSet;
+        for (int key : keys)
+            stdSet.insert(key);
+        double setBuild = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / n;
+
+        vector<int> sorted(stdSet.begin(), stdSet.end());
+
+        int avlFound = 0, setFound = 0, vectorFound = 0;
+        start = chrono::steady_clock::now();
+        for (int key : lookups)
+            avlFound += avl.find(key) != avl.end();
+        double avlFind = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / queries;
+
+        start = chrono::steady_clock::now();
+        for (int key : lookups)
+            setFound += stdSet.find(key) != stdSet.end();
+        double setFind = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / queries;
+
+        start = chrono::steady_clock::now();
+        for (int key : lookups)
+            vectorFound += binary_search(sorted.begin(), sorted.end(), key);
+        double vectorFind = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / queries;
+
+        cout << setw(10) << n << fixed << setprecision(1)
+             << setw(12) << avlBuild << setw(12) << setBuild
+             << setw(12) << avlFind << setw(12) << setFind << setw(12) << vectorFind
+             << avl.height()
+             << (avlFound == setFound && setFound == vectorFound ? "" : "  MISMATCH") << endl;
+    }
+    cout << right << setprecision(6);
+    cout.unsetf(ios::fixed);
+}
+
+// LCA and subtree sums on a random BST: pointer walks vs TreeIndex
+void benchmarkTreeIndex(int n, int queries) {
+    cout << "\n=== BENCHMARK: " << n << "-node random BST, " << queries << " LCA / subtree queries ===" << endl;
+
+    // Random insertion order gives a typical (unbalanced) BST shape
+    vector<int> keys(n);
+    for (int i = 0; i < n; ++i)
+        keys[i] = i;
+    mt19937 rng(49);
+    shuffle(keys.begin(), keys.end(), rng);
+
+    vector<BTNode*> byKey(n);
+    BTNode* root = nullptr;
+    for (int key : keys) {
+        BTNode** link = &root;
+        while (*link)
+            link = key < (*link)->val ? &(*link)->left : &(*link)->right;
+        *link = byKey[key] = new BTNode(key);
+    }
+
+    // Random pairs mostly meet near the root; pairs of nearby keys meet
+    // deep in the tree, where the O(h) walk is long
+    vector<pair<int, int>> randomPairs(queries), nearPairs(queries);
+    for (int i = 0; i < queries; ++i) {
+        randomPairs[i] = { (int)(rng() % n), (int)(rng() % n) };
+        int key = (int)(rng() % (n - 16));
+        nearPairs[i] = { key, key + 1 + (int)(rng() % 16) };
+    }
+
+    auto start = chrono::steady_clock::now();
+    TreeIndex index(root);
+    double buildMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    cout << "TreeIndex build:            " << buildMs << " ms" << endl;
+
+    for (const auto* pairs : { &randomPairs, &nearPairs }) {
+        // O(h): descend from the root until the two keys split
+        long long walkCheck = 0;
+        start = chrono::steady_clock::now();
+        for (const auto& q : *pairs) {
+            int lo = min(q.first, q.second), hi = max(q.first, q.second);
+            BTNode* node = root;
+            while (node->val > hi || node->val < lo)
+                node = node->val > hi ? node->left : node->right;
+            walkCheck += node->val;
+        }
+        double walkNs = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / queries;
+
+        // Node ids are looked up once; a caller keeps ids, not pointers
+        vector<pair<int, int>> ids(queries);
+        for (int i = 0; i < queries; ++i)
+            ids[i] = { index.id(byKey[(*pairs)[i].first]), index.id(byKey[(*pairs)[i].second]) };
+
+        long long indexCheck = 0;
+        start = chrono::steady_clock::now();
+        for (const auto& q : ids)
+            indexCheck += index.node(index.lca(q.first, q.second))->val;
+        double indexNs = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / queries;
+
+        const char* label = pairs == &randomPairs ? "random pairs" : "nearby keys ";
+        cout << "LCA (" << label << ") by pointer walk: " << walkNs << " ns, by TreeIndex: "
+             << indexNs << " ns  (" << walkNs / indexNs << "x)"
+             << (walkCheck == indexCheck ? "" : "  MISMATCH") << endl;
+    }
+
+    // Subtree sums: traverse the subtree vs two prefix-sum lookups
+    long long traverseSum = 0;
+    start = chrono::steady_clock::now();
+    for (const auto& q : randomPairs)
+        inorderVisit(byKey[q.first], [&](int val) { traverseSum += val; });
+    double traverseNs = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / queries;
+
+    vector<int> sumIds(queries);
+    for (int i = 0; i < queries; ++i)
+        sumIds[i] = index.id(byKey[randomPairs[i].first]);
+
+    long long indexSum = 0;
+    start = chrono::steady_clock::now();
+    for (int id : sumIds)
+        indexSum += index.subtreeSum(id);
+    double sumNs = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / queries;
+
+    cout << "Subtree sum by traversal: " << traverseNs << " ns, by TreeIndex: " << sumNs
+         << " ns  (" << traverseNs / sumNs << "x)"
+         << (traverseSum == indexSum ? "" : "  MISMATCH") << endl;
+
+    deleteTree(root);
+}
+
 // ============================================================================
 // MAIN - TEST THE IMPLEMENTATIONS
 // ============================================================================
 
-int main() {
+// ./week12          demo of every part (well under a second)
+// ./week12 --bench  10,000,000-deep tree check and the large benchmarks
+int main(int argc, char* argv[]) {
+    if (argc > 1 && strcmp(argv[1], "--bench") == 0) {
+        checkDeepTree(10000000);
+        benchmarkTreeLayouts((1 << 21) - 1, 1000000);
+        benchmarkArena(1000000, 10);
+        benchmarkParallelTrees(1 << 22);
+        benchmarkBalancedTrees(1000000, 1000000);
+        benchmarkTreeIndex(1000000, 1000000);
+        return 0;
+    }
+
     // Create tree from level-order input
     // Tree structure:
     //        1
@@ -245,6 +1803,125 @@ int main() {
     
     cout << "Post-order Traversal (Left-Right-Root): ";
     printTraversal(postorderTraversal(root));
+
+    // Same tree, copied into one contiguous array in vEB order
+    BlockedTree blocked(root);
+    cout << "\nBlockedTree (vEB layout) in-order:     ";
+    blocked.inorder([](int val) { cout << val << " "; });
+    cout << endl;
+    cout << "BlockedTree array order:               ";
+    for (int i = 0; i < blocked.size(); ++i)
+        cout << blocked.node(i).val << " ";
+    cout << endl;
+
+    // Iterative versions, appending into one reused buffer
+    vector<int> buffer;
+    cout << "\nIterative in-order (Morris):           ";
+    inorderTraversal(root, buffer);
+    printTraversal(buffer);
+    cout << "Iterative pre-order (Morris):          ";
+    buffer.clear();
+    preorderTraversal(root, buffer);
+    printTraversal(buffer);
+    cout << "Iterative post-order (explicit stack): ";
+    buffer.clear();
+    postorderTraversal(root, buffer);
+    printTraversal(buffer);
+
+    // Same tree again, built in an arena and freed in one step
+    NodeArena arena;
+    uint32_t arenaRoot = createTree(levelOrder, arena);
+    cout << "Arena in-order (" << arena.size() << " nodes, "
+         << sizeof(ArenaNode) << " bytes each):  ";
+    inorderVisit(arena, arenaRoot, [](int val) { cout << val << " "; });
+    cout << endl;
+    arena.reset();
+
+    // Same tree built with the parallel builder, then fork-join queries
+    vector<BTNode> storage;
+    BTNode* parallelRoot = createTreeParallel(levelOrder, storage);
+    cout << "\nParallel-built in-order:               ";
+    buffer.clear();
+    inorderTraversal(parallelRoot, buffer);
+    printTraversal(buffer);
+    cout << "parallelSum: " << parallelSum(parallelRoot);
+    cout << ", even values (pre-order): ";
+    printTraversal(parallelFilter(parallelRoot, [](int val) { return val % 2 == 0; }));
+    parallelForEach(parallelRoot, [](int& val) { val *= 10; });
+    cout << "After parallelForEach(x10), in-order:  ";
+    buffer.clear();
+    inorderTraversal(parallelRoot, buffer);
+    printTraversal(buffer);
+
+    // Sorted inserts would turn a plain BST into a list; AVL stays balanced
+    AVLTree avl;
+    for (int key = 1; key <= 15; ++key)
+        avl.insert(key);
+    avl.erase(8);
+    cout << "\nAVL tree after inserting 1..15 and erasing 8: ";
+    for (AVLTree::iterator it = avl.begin(); it != avl.end(); ++it)
+        cout << *it << " ";
+    cout << "(height " << avl.height() << ")" << endl;
+    cout << "lower_bound(8) = " << *avl.lower_bound(8)
+         << ", find(15) " << (avl.find(15) != avl.end() ? "found" : "not found") << endl;
+
+    // Save in the compact format and traverse the file without BTNodes
+    writeCompactTree(levelOrder, "week12_tree.bin");
+    {
+        CompactTreeView view("week12_tree.bin");
+        cout << "\nCompact file in-order (" << view.size() << " nodes):   ";
+        inorderVisit(view, [](int val) { cout << val << " "; });
+        cout << endl;
+    }
+    remove("week12_tree.bin");
+
+    // A 1,000,000-node random tree streamed straight into the format
+    {
+        CompactTreeWriter writer("week12_tree.bin");
+        unsigned seed = 48;
+        size_t entries = 0;
+        long long expectedSum = 0;
+        vector<int> check;
+        for (size_t i = 0; i < 1300000; ++i) {
+            seed = seed * 1103515245u + 12345u;
+            int entry = (seed >> 16) % 4 == 0 ? -1 : (int)((seed >> 8) % 1000);
+            writer.add(entry);
+            check.push_back(entry);
+            ++entries;
+        }
+        writer.finish();
+
+        CompactTreeView view("week12_tree.bin");
+        long long viewSum = 0;
+        inorderVisit(view, [&](int val) { viewSum += val; });
+        BTNode* checkRoot = createTree(check);
+        inorderVisit(checkRoot, [&](int val) { expectedSum += val; });
+        deleteTree(checkRoot);
+
+        ifstream file("week12_tree.bin", ios::binary | ios::ate);
+        cout << view.size() << "-node tree: level-order vector " << entries * sizeof(int)
+             << " bytes, compact file " << (long long)file.tellg() << " bytes"
+             << (viewSum == expectedSum ? "" : "  MISMATCH") << endl;
+    }
+    remove("week12_tree.bin");
+
+    // LCA / subtree queries on the original tree (ids are in-order positions)
+    {
+        TreeIndex index(root);
+        BTNode* four = root->left->left;
+        BTNode* six = root->left->right->right;
+        cout << "\nLCA(4, 6) = " << index.lca(four, six)->val
+             << ", LCA(6, 3) = " << index.lca(six, root->right)->val
+             << ", subtree sum of 2 = " << index.subtreeSum(index.id(root->left))
+             << ", 2 is ancestor of 6: " << (index.isAncestor(index.id(root->left), index.id(six)) ? "yes" : "no")
+             << endl;
+    }
+
+    deleteTree(root);
+
+    // A deep tree: the recursive traversals would need one stack frame
+    // per level (./week12 --bench checks a 10,000,000-deep one)
+    checkDeepTree(100000);
     
     return 0;
 }
@@ -253,10 +1930,66 @@ int main() {
  * EXPECTED OUTPUT:
  * 
  * Tree created from level-order: [1, 2, 3, 4, 5, -1, -1, -1, -1, -1, 6]
- * 
+ *
  * In-order Traversal (Left-Root-Right): 4 2 5 6 1 3 
  * Pre-order Traversal (Root-Left-Right): 1 2 4 5 6 3 
  * Post-order Traversal (Left-Right-Root): 4 6 5 2 3 1 
+ *
+ * BlockedTree (vEB layout) in-order:     4 2 5 6 1 3 
+ * BlockedTree array order:               1 2 3 4 5 6 
+ *
+ * Iterative in-order (Morris):           4 2 5 6 1 3 
+ * Iterative pre-order (Morris):          1 2 4 5 6 3 
+ * Iterative post-order (explicit stack): 4 6 5 2 3 1 
+ * Arena in-order (6 nodes, 12 bytes each):  4 2 5 6 1 3 
+ *
+ * Parallel-built in-order:               4 2 5 6 1 3 
+ * parallelSum: 21, even values (pre-order): 2 4 6 
+ * After parallelForEach(x10), in-order:  40 20 50 60 10 30 
+ *
+ * AVL tree after inserting 1..15 and erasing 8: 1 2 3 4 5 6 7 9 10 11 12 13 14 15 (height 4)
+ * lower_bound(8) = 9, find(15) found
+ *
+ * Compact file in-order (6 nodes):   4 2 5 6 1 3 
+ * 975014-node tree: level-order vector 5200000 bytes, compact file 4174304 bytes
+ *
+ * LCA(4, 6) = 2, LCA(6, 3) = 1, subtree sum of 2 = 17, 2 is ancestor of 6: yes
+ *
+ * 100000-deep tree traversed iteratively: sums 49950000 / 49950000 / 49950000
+ *
+ * BENCHMARK OUTPUT (./week12 --bench):
+ *
+ * 10000000-deep tree traversed iteratively: sums 4995000000 / 4995000000 / 4995000000
+ *
+ * === BENCHMARK: 2097151-node BST, 1000000 searches ===
+ * BTNode search:      226.807 ns
+ * BlockedTree search: 189.481 ns  (1.19699x)
+ * inorderTraversal():   185.501 ms
+ * BlockedTree in-order: 6.45393 ms  (28.7423x)
+ *
+ * === BENCHMARK: build + traverse + free, 10 trees of 1000000 nodes ===
+ * new/delete BTNode (24 bytes): 40.4978 ms per tree
+ * NodeArena (12 bytes):        8.77042 ms per tree  (4.61754x)
+ *
+ * === BENCHMARK: parallel trees, 4194304 nodes, 1 hardware threads ===
+ * createTreeParallel, 1 thread:     37.5486 ms
+ * createTreeParallel, 1 thread(s):  37.4833 ms  (1.00174x)
+ * parallelSum,        1 thread:     11.6344 ms
+ * parallelSum,        1 thread(s):  10.7134 ms  (1.08597x)
+ *
+ * === BENCHMARK: AVL tree vs std::set vs sorted vector ===
+ * keys      AVL build   set build   AVL find    set find    vector find AVL height
+ *           (ns/key)    (ns/key)    (ns)        (ns)        (ns)        
+ * 1000      87.1        99.5        22.5        63.8        62.5        12
+ * 10000     143.8       102.0       38.4        105.0       81.9        16
+ * 100000    217.8       182.4       82.5        312.0       117.8       20
+ * 1000000   898.8       726.2       532.5       1165.1      172.3       24
+ *
+ * === BENCHMARK: 1000000-node random BST, 1000000 LCA / subtree queries ===
+ * TreeIndex build:            488.508 ms
+ * LCA (random pairs) by pointer walk: 19.0207 ns, by TreeIndex: 24.7817 ns  (0.767527x)
+ * LCA (nearby keys ) by pointer walk: 367.352 ns, by TreeIndex: 48.1724 ns  (7.62578x)
+ * Subtree sum by traversal: 1618.35 ns, by TreeIndex: 13.965 ns  (115.886x)
  */
 
 /*
@@ -333,6 +2066,33 @@ int main() {
  *    - Null pointers represent absence of children
  *    - Level-order input with -1 for null nodes
  * 
+ * AVL TREE (PART 7):
+ * - insert / erase / find / lower_bound: O(log n) worst case
+ * - Height <= ~1.44 log2(n), even for sorted input (a plain BST would
+ *   have height n)
+ * - At most two rotations per insert; erase may rotate at every level
+ *   on the way up, still O(log n)
+ * - Against a sorted vector: updates are O(log n) instead of O(n), but
+ *   every search step is a pointer chase, so static data searches faster
+ *   in a vector (see week 10)
+ * 
+ * COMPACT TREE FILES (PART 8):
+ * - Size: 2 bits of shape + 4 bytes of value per node, plus a 64-bit
+ *   rank count per 512 shape bits; the -1 sentinels cost nothing
+ * - left / right: O(1) (at most 8 popcounts per step)
+ * - Writing: one pass over the level-order entries, O(n) time, only the
+ *   shape (n / 4 bytes) is held in memory
+ * - Opening is O(1): the file is mapped, and pages are read only when a
+ *   traversal touches them, so trees larger than RAM can be queried
+ * 
+ * LCA / SUBTREE INDEX (PART 9):
+ * - Build: O(n log n) time and space (log n sparse-table levels of n ints)
+ * - lca, isAncestor, subtreeSize, subtreeSum: O(1)
+ * - Walking pointers costs O(h) per LCA and O(size) per subtree sum;
+ *   the gain is largest for deep LCAs and large subtrees
+ * - The index is for static trees: any insert or delete shifts the
+ *   in-order ids, so it must be rebuilt
+ * 
  * COMMON TREE PROBLEMS:
  * 
  * Easy:
@@ -362,8 +2122,26 @@ int main() {
  * 
  * PERFORMANCE NOTES:
  * 
+ * - Pointer-based nodes are wherever the allocator put them; a search
+ *   pays a cache miss at nearly every level once the tree outgrows cache
+ * - The van Emde Boas layout (BlockedTree) keeps every small subtree in
+ *   contiguous memory: O(log_B n) cache lines per root-to-leaf path for
+ *   any line size B, and 12-byte index-linked nodes instead of 24-byte
+ *   pointer nodes
+ * - An arena (NodeArena) replaces one new/delete per node with a
+ *   counter bump, and frees a whole tree in O(1) with reset()
+ * - Level-order input fixes every node's children by arithmetic (the
+ *   k-th non-null entry owns slots 2k+1 and 2k+2), so after a parallel
+ *   prefix count all nodes can be built at once on all cores
+ * - Fork-join reductions split at nodes with two children; single-child
+ *   chains are walked in a loop, so recursion stays shallow
+ * - Building the layout is O(n) extra work, so it pays off for trees
+ *   that are searched many times after being built
  * - Recursive traversals are elegant but use stack space
  * - Iterative versions use explicit stack (same space, no recursion overhead)
  * - Morris traversal achieves O(1) space but modifies tree temporarily
  * - For very deep trees, iterative may be preferred to avoid stack overflow
+ * - The PART 2 versions also copy every value once per ancestor: O(n * h)
+ *   total; the PART 4 visitors and buffer overloads are O(n) with no
+ *   temporary vectors at all
  */
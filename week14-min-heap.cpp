@@ -20,6 +20,14 @@
 
 #include <iostream>
 #include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <cstddef>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
 
 class MinHeap {
 private:
@@ -69,6 +77,35 @@ private:
         }
     }
 
+    /*
+     * HEAPIFY DOWN - Restore min-heap property after replacing the root
+     * 
+     * Process:
+     * 1. Start at the replaced element
+     * 2. Find its smaller child
+     * 3. If that child is smaller, move the child up one level
+     * 4. Repeat until both children are >= the value or we reach a leaf,
+     *    then drop the value into the hole
+     * 
+     * Moving children up (instead of swapping at every level) writes the
+     * value only once.
+     * 
+     * Time Complexity: O(log n)
+     */
+    void heapifyDown(int idx) {
+        int n = data.size();
+        int value = data[idx];
+        while (true) {
+            int child = 2 * idx + 1;  // Left child
+            if (child >= n) break;
+            if (child + 1 < n && data[child + 1] < data[child]) child++;
+            if (data[child] >= value) break;
+            data[idx] = data[child];
+            idx = child;
+        }
+        data[idx] = value;
+    }
+
 public:
     MinHeap() = default;
 
@@ -113,6 +150,37 @@ public:
         heapifyUp(data.size() - 1);
     }
 
+    /*
+     * REPLACE MIN - Overwrite the root with a new value
+     * 
+     * Same result as extracting the minimum and inserting value, but
+     * with one sift-down instead of two sifts. Used by TopKHeap to
+     * swap out its smallest value.
+     * 
+     * Time Complexity: O(log n)
+     */
+    void replaceMin(int value) {
+        if (data.empty()) {
+            throw std::runtime_error("Heap is empty");
+        }
+        data[0] = value;
+        heapifyDown(0);
+    }
+
+    /*
+     * RESERVE - Pre-allocate room for capacity elements
+     */
+    void reserve(int capacity) {
+        data.reserve(capacity);
+    }
+
+    /*
+     * CONTENTS - Underlying array, in heap order (root first)
+     */
+    const std::vector<int>& contents() const {
+        return data;
+    }
+
     /*
      * PRINT - Display current heap contents
      * 
@@ -155,6 +223,189 @@ public:
     }
 };
 
+// ============================================================================
+// STREAMING TOP-K SELECTION (bounded min heap)
+// ============================================================================
+
+/*
+ * TOP-K HEAP - Keep only the K largest values seen in a stream
+ * 
+ * Pushing every item of a huge stream into MinHeap costs O(log n) per item
+ * and O(n) memory. For "top K" we only ever need K slots:
+ * 
+ * - The heap holds the K largest values seen so far
+ * - The root (minimum of those K) is the current THRESHOLD
+ * - A new value <= threshold can never enter the top K, so it is
+ *   rejected with a single comparison (the common case on long streams)
+ * - A value > threshold replaces the root and is sifted down
+ *   (MinHeap::replaceMin); the heap itself is a MinHeap
+ * 
+ * Time Complexity:
+ * - Rejected item: O(1) (one compare)
+ * - Accepted item: O(log K)
+ * - Whole stream:  O(n + a log K) where a = accepted items (a << n)
+ * 
+ * Space Complexity: O(K)
+ */
+class TopKHeap {
+private:
+    MinHeap heap;  // The current top K values
+    std::size_t k;
+
+    // Scalar path shared by offer() and the tail of offerBatch()
+    void offerScalar(const int* values, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            offer(values[i]);
+        }
+    }
+
+public:
+    explicit TopKHeap(std::size_t k) : k(k) {
+        heap.reserve(k);
+    }
+
+    /*
+     * OFFER - Consider one value for the top K
+     * 
+     * Returns: true if the value entered the heap
+     */
+    bool offer(int value) {
+        if (k == 0) return false;
+
+        // Still filling up: a plain MinHeap insert
+        if (size() < k) {
+            heap.insert(value);
+            return true;
+        }
+
+        // Threshold short-circuit: one compare rejects most items
+        if (value <= heap.getMin()) {
+            return false;
+        }
+
+        // Replace the smallest of the top K and sift down
+        heap.replaceMin(value);
+        return true;
+    }
+
+    /*
+     * OFFER BATCH - Consider a block of values
+     * 
+     * Once the heap is full, values are compared against the threshold
+     * 8 (AVX2) or 4 (SSE2) at a time. A block with no value above the
+     * threshold is skipped entirely; otherwise only that block goes
+     * through the scalar path. Falls back to scalar when SIMD is not
+     * available at compile time.
+     */
+    void offerBatch(const int* values, std::size_t n) {
+        std::size_t i = 0;
+
+        // Fill the heap first; there is no threshold until it is full
+        while (i < n && size() < k) {
+            offer(values[i++]);
+        }
+        if (k == 0) return;
+
+#if defined(__AVX2__)
+        for (; i + 8 <= n; i += 8) {
+            __m256i threshold = _mm256_set1_epi32(heap.getMin());
+            __m256i block = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(values + i));
+            __m256i gt = _mm256_cmpgt_epi32(block, threshold);
+            if (_mm256_movemask_epi8(gt) != 0) {
+                offerScalar(values + i, 8);
+            }
+        }
+#elif defined(__SSE2__)
+        for (; i + 4 <= n; i += 4) {
+            __m128i threshold = _mm_set1_epi32(heap.getMin());
+            __m128i block = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(values + i));
+            __m128i gt = _mm_cmpgt_epi32(block, threshold);
+            if (_mm_movemask_epi8(gt) != 0) {
+                offerScalar(values + i, 4);
+            }
+        }
+#endif
+
+        // Remaining tail (or everything when no SIMD)
+        offerScalar(values + i, n - i);
+    }
+
+    /*
+     * MERGE - Fold another partial top-K heap into this one
+     * 
+     * Used to combine per-thread results: every value in the other
+     * heap is offered here, so the result is the top K of both.
+     */
+    void merge(const TopKHeap& other) {
+        for (int v : other.heap.contents()) {
+            offer(v);
+        }
+    }
+
+    /*
+     * THRESHOLD - Smallest value currently in the top K
+     * 
+     * Only meaningful once the heap is full.
+     */
+    int threshold() const {
+        return heap.getMin();  // Throws if the heap is empty
+    }
+
+    // Top K values, largest first
+    std::vector<int> sortedDescending() const {
+        std::vector<int> result(heap.contents());
+        std::sort(result.begin(), result.end(), [](int a, int b) { return a > b; });
+        return result;
+    }
+
+    std::size_t size() const {
+        return heap.size();
+    }
+
+    bool isFull() const {
+        return size() == k;
+    }
+};
+
+/*
+ * PARALLEL TOP-K - Split the stream across threads
+ * 
+ * Each thread runs its own TopKHeap over a contiguous chunk (no sharing,
+ * no locks), then the partial heaps are merged on the calling thread.
+ * Merging costs only O(T * K log K) for T threads.
+ * 
+ * Returns: top K values, largest first
+ */
+std::vector<int> topKParallel(const std::vector<int>& values, std::size_t k,
+                              unsigned numThreads = std::thread::hardware_concurrency()) {
+    if (numThreads == 0) numThreads = 1;
+    std::size_t n = values.size();
+    if (n < numThreads * 4096) numThreads = 1;  // Not worth spawning threads
+
+    std::vector<TopKHeap> partial(numThreads, TopKHeap(k));
+    std::vector<std::thread> workers;
+    std::size_t chunk = (n + numThreads - 1) / numThreads;
+
+    for (unsigned t = 0; t < numThreads; ++t) {
+        std::size_t begin = std::min(n, t * chunk);
+        std::size_t end = std::min(n, begin + chunk);
+        workers.emplace_back([&partial, &values, t, begin, end]() {
+            partial[t].offerBatch(values.data() + begin, end - begin);
+        });
+    }
+    for (std::thread& w : workers) {
+        w.join();
+    }
+
+    TopKHeap result(k);
+    for (const TopKHeap& h : partial) {
+        result.merge(h);
+    }
+    return result.sortedDescending();
+}
+
 // ============================================================================
 // MAIN - TEST THE MIN HEAP IMPLEMENTATION
 // ============================================================================
@@ -192,6 +443,31 @@ int main() {
     std::cout << "\nMinimum element: " << h.getMin() << std::endl;
     std::cout << "Heap size: " << h.size() << std::endl;
 
+    // ------------------------------------------------------------------
+    // Streaming top-K demo
+    // ------------------------------------------------------------------
+    std::cout << "\n=== STREAMING TOP-K DEMO ===" << std::endl;
+
+    // Deterministic pseudo-random stream (LCG) so output is reproducible
+    std::vector<int> stream(1000000);
+    unsigned int seed = 12345;
+    for (std::size_t i = 0; i < stream.size(); ++i) {
+        seed = seed * 1103515245u + 12345u;
+        stream[i] = static_cast<int>((seed >> 8) % 1000000);
+    }
+
+    TopKHeap top(5);
+    top.offerBatch(stream.data(), stream.size());
+    std::vector<int> serial = top.sortedDescending();
+    std::vector<int> parallel = topKParallel(stream, 5);
+
+    std::cout << "Stream size: " << stream.size() << std::endl;
+    std::cout << "Top 5 (batch):    ";
+    for (int v : serial) std::cout << v << " ";
+    std::cout << "\nTop 5 (parallel): ";
+    for (int v : parallel) std::cout << v << " ";
+    std::cout << "\nResults match: " << (serial == parallel ? "YES" : "NO") << std::endl;
+
     return 0;
 }
 
@@ -222,6 +498,12 @@ int main() {
  * 
  * Minimum element: 2
  * Heap size: 5
+ * 
+ * === STREAMING TOP-K DEMO ===
+ * Stream size: 1000000
+ * Top 5 (batch):    999999 999999 999995 999995 999994 
+ * Top 5 (parallel): 999999 999999 999995 999995 999994 
+ * Results match: YES
  */
 
 /*
@@ -266,6 +548,7 @@ int main() {
  * Operation   | Best Case | Average | Worst Case | Notes
  * ------------|-----------|---------|------------|------------------
  * Insert      | O(1)      | O(log n)| O(log n)  | Best: no swaps needed
+ * Replace Min | O(1)      | O(log n)| O(log n)  | One sift-down
  * Get Min     | O(1)      | O(1)    | O(1)      | Always at root
  * Size        | O(1)      | O(1)    | O(1)      | Vector size
  * 
@@ -357,9 +640,10 @@ int main() {
  *    - Extract min n times: O(n log n)
  *    - In-place sorting algorithm
  * 
- * 3. **K Smallest Elements:**
+ * 3. **K Smallest / K Largest Elements:**
  *    - Efficiently find k smallest from n elements
  *    - Better than sorting entire array
+ *    - See TopKHeap: bounded heap of size K, O(1) reject per item
  * 
  * 4. **Median Maintenance:**
  *    - Use two heaps (min + max)
@@ -13,6 +13,8 @@
  */
 
 #include <iostream>
+#include <vector>
+#include <initializer_list>
 using namespace std;
 
 // Node structure
@@ -24,42 +26,140 @@ struct Node {
     Node(int val) : data(val), next(nullptr) {}
 };
 
+// Node pool - hands out nodes from blocks of BLOCK_SIZE and keeps
+// released nodes on a free list (linked through their next pointers),
+// so a list that keeps inserting and deleting stops calling new/delete
+class NodePool {
+private:
+    static const int BLOCK_SIZE = 256;
+    
+    vector<Node*> blocks;   // Raw memory, freed in the destructor
+    int usedInBlock;        // Nodes handed out from the newest block
+    Node* freeList;         // Released nodes, ready for reuse
+    int allocated;          // Nodes ever handed out from blocks
+    
+public:
+    NodePool() : usedInBlock(BLOCK_SIZE), freeList(nullptr), allocated(0) {}
+    
+    // Get a node holding value - O(1)
+    Node* acquire(int value) {
+        Node* node;
+        if (freeList != nullptr) {
+            node = freeList;
+            freeList = freeList->next;
+        } else {
+            if (usedInBlock == BLOCK_SIZE) {
+                blocks.push_back(static_cast<Node*>(::operator new(BLOCK_SIZE * sizeof(Node))));
+                usedInBlock = 0;
+            }
+            node = blocks.back() + usedInBlock++;
+            allocated++;
+        }
+        return new (node) Node(value);
+    }
+    
+    // Give a node back for reuse - O(1)
+    void release(Node* node) {
+        node->next = freeList;
+        freeList = node;
+    }
+    
+    // Number of distinct nodes ever created (live + on the free list)
+    int getAllocated() {
+        return allocated;
+    }
+    
+    // Node has no destructor to run, so freeing the blocks frees every node
+    ~NodePool() {
+        for (Node* block : blocks) {
+            ::operator delete(block);
+        }
+    }
+    
+    // The pool owns its blocks, so it cannot be copied
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+};
+
 // Linked List class
 class LinkedList {
 private:
     Node* head;
+    Node* tail;     // Last node, so appending is O(1)
     int size;
+    NodePool pool;  // Every node comes from (and goes back to) the pool
     
 public:
     // Constructor
-    LinkedList() : head(nullptr), size(0) {}
+    LinkedList() : head(nullptr), tail(nullptr), size(0) {}
     
     // Insert at the beginning - O(1)
     void insertAtHead(int value) {
-        Node* newNode = new Node(value);
+        Node* newNode = pool.acquire(value);
         newNode->next = head;
         head = newNode;
+        if (tail == nullptr) {
+            tail = newNode;
+        }
         size++;
         cout << "Inserted " << value << " at head" << endl;
     }
     
-    // Insert at the end - O(n)
+    // Insert at the end - O(1) using the tail pointer
     void insertAtTail(int value) {
-        Node* newNode = new Node(value);
+        Node* newNode = pool.acquire(value);
         
         if (head == nullptr) {
             head = newNode;
         } else {
-            Node* temp = head;
-            while (temp->next != nullptr) {
-                temp = temp->next;
-            }
-            temp->next = newNode;
+            tail->next = newNode;
         }
+        tail = newNode;
         size++;
         cout << "Inserted " << value << " at tail" << endl;
     }
     
+    // Append every value in [first, last) at the end - O(k) for k values
+    // The new nodes are linked to each other first and attached to the
+    // list once, and nothing is printed per value
+    template <typename Iterator>
+    void append(Iterator first, Iterator last) {
+        Node* chainHead = nullptr;
+        Node* chainTail = nullptr;
+        int count = 0;
+        
+        for (; first != last; ++first) {
+            Node* newNode = pool.acquire(*first);
+            if (chainHead == nullptr) {
+                chainHead = newNode;
+            } else {
+                chainTail->next = newNode;
+            }
+            chainTail = newNode;
+            count++;
+        }
+        
+        if (count == 0) return;
+        
+        if (head == nullptr) {
+            head = chainHead;
+        } else {
+            tail->next = chainHead;
+        }
+        tail = chainTail;
+        size += count;
+    }
+    
+    // Append a whole container (vector, array, ...) or a {1, 2, 3} list
+    template <typename Range>
+    void append(const Range& values) {
+        append(begin(values), end(values));
+    }
+    
+    void append(initializer_list<int> values) {
+        append(values.begin(), values.end());
+    }
+    
     // Insert at specific position - O(n)
     void insertAtPosition(int value, int position) {
         if (position < 0 || position > size) {
@@ -72,7 +172,7 @@ public:
             return;
         }
         
-        Node* newNode = new Node(value);
+        Node* newNode = pool.acquire(value);
         Node* temp = head;
         
         for (int i = 0; i < position - 1; i++) {
@@ -81,6 +181,9 @@ public:
         
         newNode->next = temp->next;
         temp->next = newNode;
+        if (newNode->next == nullptr) {
+            tail = newNode;
+        }
         size++;
         cout << "Inserted " << value << " at position " << position << endl;
     }
@@ -96,7 +199,10 @@ public:
         if (head->data == value) {
             Node* temp = head;
             head = head->next;
-            delete temp;
+            if (head == nullptr) {
+                tail = nullptr;
+            }
+            pool.release(temp);
             size--;
             cout << "Deleted " << value << endl;
             return;
@@ -112,7 +218,10 @@ public:
         if (current->next != nullptr) {
             Node* temp = current->next;
             current->next = current->next->next;
-            delete temp;
+            if (temp == tail) {
+                tail = current;
+            }
+            pool.release(temp);
             size--;
             cout << "Deleted " << value << endl;
         } else {
@@ -130,7 +239,10 @@ public:
         if (position == 0) {
             Node* temp = head;
             head = head->next;
-            delete temp;
+            if (head == nullptr) {
+                tail = nullptr;
+            }
+            pool.release(temp);
             size--;
             cout << "Deleted node at position " << position << endl;
             return;
@@ -143,7 +255,10 @@ public:
         
         Node* toDelete = temp->next;
         temp->next = temp->next->next;
-        delete toDelete;
+        if (toDelete == tail) {
+            tail = temp;
+        }
+        pool.release(toDelete);
         size--;
         cout << "Deleted node at position " << position << endl;
     }
@@ -171,6 +286,7 @@ public:
         Node* prev = nullptr;
         Node* current = head;
         Node* next = nullptr;
+        tail = head;  // The old head ends up last
         
         while (current != nullptr) {
             next = current->next;
@@ -228,14 +344,13 @@ public:
         return head == nullptr;
     }
     
-    // Destructor - clean up all nodes
+    // Nodes created so far; stays flat while deletes are being reused
+    int getAllocatedNodes() {
+        return pool.getAllocated();
+    }
+    
+    // Destructor - the pool frees all nodes (live and recycled) at once
     ~LinkedList() {
-        Node* current = head;
-        while (current != nullptr) {
-            Node* next = current->next;
-            delete current;
-            current = next;
-        }
         cout << "LinkedList destroyed" << endl;
     }
 };
@@ -277,13 +392,31 @@ int main() {
     list.reverse();
     list.display();
     
+    cout << "\n=== Testing Append and Node Reuse ===" << endl;
+    list.append({6, 7, 8});
+    vector<int> more = {9, 10};
+    list.append(more);
+    list.display();
+    cout << "Nodes allocated: " << list.getAllocatedNodes() << endl;
+    
+    // Queue-like use: add at the tail, remove from the head.
+    // From the second round on, each insert reuses the node the
+    // previous delete released.
+    for (int round = 1; round <= 2; round++) {
+        list.insertAtTail(10 + round);
+        list.deleteAtPosition(0);
+    }
+    list.display();
+    cout << "Nodes allocated: " << list.getAllocatedNodes() << endl;
+    
     return 0;
 }
 
 /*
  * Time Complexity Analysis:
  * - insertAtHead(): O(1)
- * - insertAtTail(): O(n)
+ * - insertAtTail(): O(1) (tail pointer)
+ * - append(): O(k) for k values, no walk to the end
  * - insertAtPosition(): O(n)
  * - deleteByValue(): O(n)
  * - deleteAtPosition(): O(n)
@@ -299,4 +432,9 @@ int main() {
  * 3. Edge case handling (empty list, single node)
  * 4. Two-pointer technique for finding middle
  * 5. Proper memory cleanup in destructor
+ * 6. Tail pointer: must be updated by every operation that can change
+ *    the last node (insert at end, delete last node, reverse)
+ * 7. Node pool: nodes come from blocks of 256 and deleted nodes go on a
+ *    free list, so steady insert/delete traffic reuses memory instead
+ *    of calling new/delete per node
  */